@@ -3,12 +3,15 @@
  *
  * Demonstrates the "RobotisApp" kernel which acts as a Mini-OS.
  * - TaskManager: Run functions periodically without delay().
+ *   Tasks and commands can be plain functions, member functions of an
+ *   object or small lambdas (see Callback).
  * - SerialCommander: Control the board via Serial Monitor.
  * - Logger: Professional logging output.
  *
  * Commands to try in Serial Monitor:
  * - "start" : Starts the auto-counter.
  * - "stop"  : Stops the auto-counter.
+ * - "reset" : Sets the counter back to 0.
  *
  * Author: Furkan
  * License: Apache 2.0
@@ -39,6 +42,27 @@ void taskHealthCheck() {
   app.log("System Heartbeat: Alive.");
 }
 
+// --- MEMBER TASKS ---
+// The same method scheduled for several objects: no wrapper function
+// per object, the object is passed along with the method.
+
+class StatusReport {
+  private:
+    const char* _name;
+
+  public:
+    StatusReport(const char* name) {
+      _name = name;
+    }
+
+    void report() {
+      app.log(_name);
+    }
+};
+
+StatusReport radioStatus("Radio link: OK");
+StatusReport motorStatus("Motors: OK");
+
 // --- COMMANDS ---
 // Functions triggered by Serial text commands.
 
@@ -59,10 +83,13 @@ void setup() {
   // Register Tasks (Function, Interval in ms)
   app.addTask(taskCount, 1000);       // Run every 1 second
   app.addTask(taskHealthCheck, 5000); // Run every 5 seconds
+  app.addTask(Callback(&radioStatus, &StatusReport::report), 7000);
+  app.addTask(Callback(&motorStatus, &StatusReport::report), 11000);
 
   // Register Commands (Name, Function)
   app.addCommand("start", cmdStart);
   app.addCommand("stop", cmdStop);
+  app.addCommand("reset", []() { counter = 0; }); // Small lambda
 }
 
 void loop() {
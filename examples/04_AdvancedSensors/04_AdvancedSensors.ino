@@ -2,12 +2,16 @@
  * RobotisTools - Example 04: Advanced Hardware Drivers
  *
  * Demonstrates high-level hardware drivers:
- * - BatteryMonitor: Converts voltage to percentage automatically.
+ * - BatteryMonitor: Converts voltage to percentage automatically, with
+ *   load compensation so motor current does not drop the percentage.
  * - SmartAnalog: Hysteresis (Schmitt Trigger) logic for sensors.
+ * - AnalogSampler: Samples both in the background, so their getters
+ *   never wait for the ADC.
  *
  * Hardware:
  * - Battery Divider connected to Pin A0.
  * - LDR or Potentiometer connected to Pin A1.
+ * - Current sensor on Pin A2 (e.g. ACS723: 0 A at 1.65 V, 400 mV/A).
  *
  * Author: Furkan
  * License: Apache 2.0
@@ -25,6 +29,10 @@ BatteryMonitor battery(A0, 3.0, 3.3);
 // Pin: A1, Filter Size: 10
 SmartAnalog lightSensor(A1, 10);
 
+// 3. Background ADC scanner shared by all sensors
+AnalogSampler adc;
+int currentChannel; // Battery current, read from the sampler
+
 void taskBatteryCheck() {
   // Read Voltage and Percentage
   float volts = battery.getVoltage();
@@ -42,6 +50,11 @@ void setup() {
 
   // Initialize Battery (Min: 11.1V, Max: 12.6V for 3S LiPo)
   battery.begin(11.1, 12.6);
+  // Percentage from the LiPo discharge curve instead of a straight line.
+  // The curve is for resting voltage: under load the pack sags by
+  // I * R, so tell the monitor the pack resistance and the current.
+  battery.setChemistry(BATTERY_LIPO, 3);
+  battery.setInternalResistance(0.06); // Ohms, 3S pack + wiring
 
   // Initialize Light Sensor
   lightSensor.begin();
@@ -51,12 +64,27 @@ void setup() {
   lightSensor.setThreshold(2000, 100);
   lightSensor.setInvert(true);
 
+  // Hand both sensors to the sampler (one conversion every 1 ms)
+  battery.attach(adc);
+  lightSensor.attach(adc);
+  currentChannel = adc.addChannel(A2);
+  adc.setInterval(1000);
+  adc.begin();
+
   // Check battery every 3 seconds
   app.addTask(taskBatteryCheck, 3000);
 }
 
 void loop() {
   app.update();
+  adc.update();
+
+  // Load current in Amps (3.3V reference, 0 A at mid-scale).
+  // Negative readings (noise, or no sample yet) count as no load.
+  long fullScale = adc.getMaxValue(currentChannel);
+  float amps = (adc.getRaw(currentChannel) - fullScale / 2) * (3.3 / fullScale) / 0.4;
+  battery.setLoadCurrent(amps > 0 ? amps : 0);
+  battery.update(); // Samples every 100 ms; getters only read the cache
 
   // SmartAnalog handles hysteresis automatically.
   // No flickering when value is near 2000.
@@ -2,7 +2,7 @@
  * RobotisTools - Example 05: Full Robot Integration
  *
  * A complete template for a mobile robot.
- * - Saves settings (Max Speed) to EEPROM via ConfigStore.
+ * - Saves settings (Max Speed) to EEPROM via ConfigStore (in the background).
  * - Calculates Tank Drive mixing via DiffDrive.
  * - Manages system via RobotisApp.
  *
@@ -31,7 +31,7 @@ DiffDrive driveBase(1023);
 void driveTask() {
   // 1. Simulate Joystick Input (Replace with Real RC/Bluetooth data)
   int joyX = 0;   // No turning
-  int joyY = 80;  // 80% Forward speed
+  int joyY = 40;  // 40% Forward speed (full stick = full PWM)
 
   // 2. Compute Mixing
   driveBase.compute(joyX, joyY);
@@ -55,7 +55,7 @@ void driveTask() {
 void cmdSetLowSpeed() {
   RobotConfig newSettings = config.get();
   newSettings.maxSpeed = 100;
-  config.save(newSettings); // Writes to EEPROM
+  config.saveAsync(newSettings); // RAM now, EEPROM a byte per tick (no stall)
   app.log("Config Saved: Max Speed set to 100");
 }
 
@@ -69,6 +69,7 @@ void setup() {
   // Add tasks and commands
   app.addTask(driveTask, 50); // 20Hz Drive Loop
   app.addCommand("speed_low", cmdSetLowSpeed);
+  app.addConfig(config); // Let app.update() write pending settings
 }
 
 void loop() {
@@ -0,0 +1,88 @@
+/*
+ * RobotisTools - Example 07: Pin I/O Benchmark
+ *
+ * Measures the cost of one pin operation with the Arduino core
+ * (digitalWrite / digitalRead) and with FastPin, which resolves the
+ * port registers once in its constructor.
+ * Open the Serial Monitor at 115200 baud.
+ *
+ * On AVR and on the STM32duino core, FastPin is a single register
+ * access, so its numbers should be close to the empty-loop overhead.
+ * Other cores (the ROBOTIS OpenCM9.04 core included) use the portable
+ * fallback and show about the same cost for both.
+ *
+ * Hardware:
+ * - Nothing required. Pin 13 toggles very fast, Pin 2 is read.
+ *
+ * Author: Furkan
+ * License: Apache 2.0
+ */
+
+#include <RobotisTools.h>
+
+#define BENCH_OUT_PIN 13
+#define BENCH_IN_PIN  2
+#define BENCH_LOOPS   10000UL
+
+FastPin outPin(BENCH_OUT_PIN);
+FastPin inPin(BENCH_IN_PIN);
+
+volatile uint8_t sink; // Keeps reads from being optimized away
+
+// Prints the average time of one operation in nanoseconds
+void report(const char* name, unsigned long elapsedUs) {
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print((elapsedUs * 1000UL) / BENCH_LOOPS);
+  Serial.println(" ns/op");
+}
+
+void runBenchmark() {
+  unsigned long i, start;
+
+  // 1. Writes
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    digitalWrite(BENCH_OUT_PIN, i & 1);
+  report("digitalWrite  ", micros() - start);
+
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    outPin.write(i & 1);
+  report("FastPin write ", micros() - start);
+
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    outPin.toggle();
+  report("FastPin toggle", micros() - start);
+
+  // 2. Reads
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    sink = digitalRead(BENCH_IN_PIN);
+  report("digitalRead   ", micros() - start);
+
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    sink = inPin.read();
+  report("FastPin read  ", micros() - start);
+
+  // 3. Empty loop (subtract from the numbers above)
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    sink = (uint8_t)i;
+  report("loop overhead ", micros() - start);
+}
+
+void setup() {
+  Serial.begin(115200);
+  outPin.mode(OUTPUT);
+  inPin.mode(INPUT_PULLUP);
+  delay(500);
+
+  Serial.println("Pin I/O benchmark");
+  runBenchmark();
+}
+
+void loop() {
+}
@@ -0,0 +1,149 @@
+/*
+ * RobotisTools - Example 08: PID Benchmark
+ *
+ * Measures the cost of one compute() of FastPID (float) and FixedPID
+ * (Q16.16) on your board, plus the fixed-point operations they are
+ * built from. Open the Serial Monitor at 115200 baud.
+ *
+ * Three timing cases:
+ * - steady:   every call exactly one sample time apart (no dt ratio)
+ * - jittered: 1.000 .. 1.096 ms apart, so dt/Ts and Ts/dt are computed
+ * - filtered: jittered, with the derivative low-pass on
+ *
+ * On FPU-less chips (AVR, Cortex-M0) FixedPID should be the faster one;
+ * with an FPU (Cortex-M4F, ESP32) float usually wins.
+ *
+ * Hardware:
+ * - Nothing required.
+ *
+ * Author: Furkan
+ * License: Apache 2.0
+ */
+
+#include <RobotisTools.h>
+
+#define BENCH_LOOPS 2000UL
+#define BENCH_TS_US 1000UL
+
+FastPID floatPID(2.0, 0.06, 0.5, BENCH_TS_US);
+FixedPID fixedPID(2.0, 0.06, 0.5, BENCH_TS_US);
+
+volatile float floatSink; // Keeps results from being optimized away
+volatile long fixedSink;
+volatile int inputSeed = 63;
+
+// Prints the average time of one operation in ns and CPU cycles
+void report(const char* name, unsigned long elapsedUs, unsigned long overheadUs) {
+  unsigned long us = (elapsedUs > overheadUs) ? elapsedUs - overheadUs : 0;
+  unsigned long ns = (us * 1000UL) / BENCH_LOOPS;
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(ns);
+#if defined(F_CPU)
+  Serial.print(" ns/op, ");
+  Serial.print((unsigned long)((float)ns * (F_CPU / 1000000UL) / 1000.0));
+  Serial.println(" cycles/op");
+#else
+  Serial.println(" ns/op");
+#endif
+}
+
+// Sample time step: 1000 us, or 1000 .. 1096 us when jittered
+unsigned long nextStep(unsigned long i, bool jitter) {
+  return BENCH_TS_US + (jitter ? ((i & 3) << 5) : 0);
+}
+
+void benchCompute(const char* label, bool jitter, unsigned long tau) {
+  unsigned long i, start, now, overhead;
+  int mask = inputSeed;
+
+  floatPID.setDerivativeFilter(tau);
+  fixedPID.setDerivativeFilter(tau);
+  floatPID.reset();
+  fixedPID.reset();
+
+  // 1. Loop, timestamp and input overhead
+  now = 0;
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+  {
+    now += nextStep(i, jitter);
+    fixedSink = (long)(i & mask) + (long)now;
+  }
+  overhead = micros() - start;
+
+  // 2. Float controller
+  now = 0;
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+  {
+    now += nextStep(i, jitter);
+    floatSink = floatPID.compute(100.0, (float)(int)(i & mask), now);
+  }
+  Serial.print(label);
+  report(" FastPID ", micros() - start, overhead);
+
+  // 3. Fixed-point controller
+  now = 0;
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+  {
+    now += nextStep(i, jitter);
+    fixedSink = fixedPID.compute(Q16_16(100), Q16_16((int)(i & mask)), now).raw();
+  }
+  Serial.print(label);
+  report(" FixedPID", micros() - start, overhead);
+}
+
+void benchOps() {
+  unsigned long i, start, overhead;
+  int mask = inputSeed;
+  float fa = 1.37;
+  Q16_16 qa = 1.37;
+
+  // 1. Loop overhead
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    fixedSink = (long)(i & mask);
+  overhead = micros() - start;
+
+  // 2. Multiply
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    floatSink = fa * (float)(int)(i & mask);
+  report("float multiply    ", micros() - start, overhead);
+
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    fixedSink = (qa * Q16_16((int)(i & mask))).raw();
+  report("Q16.16 multiply   ", micros() - start, overhead);
+
+  // 3. Tick ratio (dt / Ts), as compute() does on a jittered sample
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    floatSink = (float)(BENCH_TS_US + (i & mask)) / (float)BENCH_TS_US;
+  report("float ratio       ", micros() - start, overhead);
+
+  start = micros();
+  for (i = 0; i < BENCH_LOOPS; i++)
+    fixedSink = Q16_16::ratio(BENCH_TS_US + (i & mask), BENCH_TS_US).raw();
+  report("Q16.16 ratio()    ", micros() - start, overhead);
+}
+
+void setup() {
+  Serial.begin(115200);
+  floatPID.setSampleTime(BENCH_TS_US, PID_TIMEBASE_MICROS);
+  fixedPID.setSampleTime(BENCH_TS_US, PID_TIMEBASE_MICROS);
+  floatPID.setOutputLimits(-255, 255);
+  fixedPID.setOutputLimits(Q16_16(-255), Q16_16(255));
+  delay(500);
+
+  Serial.println("PID benchmark");
+  benchCompute("steady  ", false, 0);
+  benchCompute("jittered", true, 0);
+  benchCompute("filtered", true, 2000);
+  benchOps();
+}
+
+void loop() {
+}
@@ -0,0 +1,190 @@
+/**
+ * @file Arduino.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Host (Linux/macOS) stand-in for the Arduino core.
+ * Lets the library compile natively with a virtual clock and a simulated
+ * pin / ADC layer, so control code can be run faster than real time.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+
+#define ROBOTIS_HOST 1
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+#define HIGH 1
+#define LOW  0
+
+#define INPUT          0
+#define OUTPUT         1
+#define INPUT_PULLUP   2
+#define INPUT_PULLDOWN 3
+#define INPUT_ANALOG   4
+
+#define CHANGE  1
+#define FALLING 2
+#define RISING  3
+#define NOT_AN_INTERRUPT -1
+
+#define A0 100
+#define A1 101
+#define A2 102
+#define A3 103
+#define A4 104
+#define A5 105
+
+#define BOARD_LED_PIN    14
+#define BOARD_BUTTON_PIN 23
+
+#define HOST_NUM_PINS 128
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_float(addr) (*(const float*)(addr))
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define digitalPinToInterrupt(p) ((p) < HOST_NUM_PINS ? (int)(p) : NOT_AN_INTERRUPT)
+
+// =============================================================================
+// ARDUINO API (implemented in HostArduino.cpp)
+// =============================================================================
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout = 1000000UL);
+
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(), int mode);
+void detachInterrupt(uint8_t interruptNum);
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+/**
+ * @brief Minimal Serial: output goes to stdout, input comes from hostSerialFeed().
+ */
+class HostSerial {
+  public:
+    operator bool() { return true; }
+    void begin(long baud) { (void)baud; }
+    int available();
+    int read();
+
+    void print(const char* s) { fputs(s, stdout); }
+    void print(char c) { fputc(c, stdout); }
+    void print(int v) { printf("%d", v); }
+    void print(unsigned int v) { printf("%u", v); }
+    void print(long v) { printf("%ld", v); }
+    void print(unsigned long v) { printf("%lu", v); }
+    void print(double v, int digits = 2) { printf("%.*f", digits, v); }
+
+    void println() { fputc('\n', stdout); }
+    template <class V> void println(V v) { print(v); println(); }
+    void println(double v, int digits) { print(v, digits); println(); }
+};
+
+extern HostSerial Serial;
+
+// =============================================================================
+// SIMULATION CONTROL (host only)
+// =============================================================================
+
+/**
+ * @brief Sets the virtual clock (micros() / millis() derive from it).
+ */
+void hostSetMicros(uint64_t us);
+
+/**
+ * @brief Advances the virtual clock. Does not sleep.
+ */
+void hostAdvanceMicros(uint64_t us);
+
+/**
+ * @brief Current virtual time (64-bit, never wraps).
+ */
+uint64_t hostMicros();
+
+/**
+ * @brief Drives an input pin level as seen by digitalRead().
+ * Fires an attached interrupt handler if the edge matches its mode.
+ */
+void hostSetPin(uint8_t pin, int level);
+
+/**
+ * @brief Level last written to an output pin with digitalWrite().
+ */
+int hostGetPin(uint8_t pin);
+
+/**
+ * @brief Sets the value returned by analogRead() (raw ADC counts).
+ */
+void hostSetAnalog(uint8_t pin, int value);
+
+/**
+ * @brief Virtual time (us) each analogRead() blocks for (default 0).
+ * ~104 us models an AVR conversion at the default prescaler.
+ */
+void hostSetAnalogCost(unsigned long us);
+
+/**
+ * @brief Per-conversion ADC model: when set, analogRead() returns hook(pin)
+ * instead of the hostSetAnalog() value (e.g. to add noise / dither).
+ */
+void hostSetAnalogHook(int (*hook)(uint8_t pin));
+
+/**
+ * @brief Number of analogRead() calls so far.
+ */
+unsigned long hostAnalogReads();
+
+/**
+ * @brief Last duty written with analogWrite().
+ */
+int hostGetAnalogWrite(uint8_t pin);
+
+/**
+ * @brief Width (us) of the pulse pulseIn() will report on a pin (0 = timeout).
+ * pulseIn() advances the virtual clock by the time it would have blocked.
+ */
+void hostSetPulseWidth(uint8_t pin, unsigned long us);
+
+/**
+ * @brief Queues text to be returned by Serial.read().
+ */
+void hostSerialFeed(const char* text);
+
+#endif
@@ -0,0 +1,142 @@
+/**
+ * @file EEPROM.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Host stand-in for the Arduino EEPROM library (RAM backed).
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+#include <Arduino.h>
+
+#define HOST_EEPROM_SIZE 4096
+
+/**
+ * @brief Byte-addressable EEPROM image in RAM, erased to 0xFF.
+ * Counts writes per cell (wear) and can simulate a power cut: after
+ * hostFailAfter(n) writes, further writes are silently dropped.
+ *
+ * With hostSetWriteTime(us) a written byte keeps the EEPROM busy for
+ * `us` of virtual time, and any access while busy waits for it by
+ * advancing the virtual clock, like AVR's busy-wait on EEPE. The time a
+ * caller spends blocked therefore shows up in hostMicros().
+ */
+class HostEEPROM {
+  private:
+    uint8_t _mem[HOST_EEPROM_SIZE];
+    uint32_t _writes[HOST_EEPROM_SIZE];
+    long _writesLeft; // -1 = no power cut scheduled
+    uint64_t _busyUntil;    // Virtual time the last byte finishes programming
+    unsigned long _writeUs; // Programming time per byte (0 = instant)
+
+    void waitReady() {
+      if (hostMicros() < _busyUntil)
+        hostSetMicros(_busyUntil);
+    }
+
+  public:
+    HostEEPROM() {
+      clear();
+      hostResetWear();
+      _writesLeft = -1;
+      _busyUntil = 0;
+      _writeUs = 0;
+    }
+
+    void clear() { memset(_mem, 0xFF, sizeof(_mem)); }
+    int length() { return HOST_EEPROM_SIZE; }
+
+    uint8_t read(int addr) {
+      waitReady();
+      return _mem[addr];
+    }
+
+    void write(int addr, uint8_t val) {
+      waitReady();
+      if (_writesLeft == 0)
+        return; // Power is gone
+      if (_writesLeft > 0)
+        _writesLeft--;
+      _mem[addr] = val;
+      _writes[addr]++;
+      _busyUntil = hostMicros() + _writeUs;
+    }
+    void update(int addr, uint8_t val) {
+      if (_mem[addr] != val)
+        write(addr, val);
+    }
+
+    template <class T> T& get(int addr, T& t) {
+      waitReady();
+      memcpy(&t, &_mem[addr], sizeof(T));
+      return t;
+    }
+
+    template <class T> const T& put(int addr, const T& t) {
+      const uint8_t* p = (const uint8_t*)&t;
+      int i;
+
+      i = 0;
+      while (i < (int)sizeof(T))
+      {
+        update(addr + i, p[i]);
+        i++;
+      }
+      return t;
+    }
+
+    // --- Simulation control (host only) ---
+
+    /**
+     * @brief Drops every write after the next n (n < 0 restores power).
+     */
+    void hostFailAfter(long n) { _writesLeft = n; }
+
+    /**
+     * @brief Programming time per byte (AVR: ~3300 us), 0 = instant.
+     */
+    void hostSetWriteTime(unsigned long us) {
+      _writeUs = us;
+      _busyUntil = 0;
+    }
+
+    /**
+     * @brief False while a byte is programming (avr-libc eeprom_is_ready()).
+     */
+    bool hostIsReady() { return hostMicros() >= _busyUntil; }
+
+    void hostResetWear() { memset(_writes, 0, sizeof(_writes)); }
+    uint32_t hostWrites(int addr) { return _writes[addr]; }
+
+    uint32_t hostTotalWrites() {
+      uint32_t total = 0;
+      int i;
+      for (i = 0; i < HOST_EEPROM_SIZE; i++)
+        total += _writes[i];
+      return total;
+    }
+
+    uint32_t hostMaxWrites() {
+      uint32_t worst = 0;
+      int i;
+      for (i = 0; i < HOST_EEPROM_SIZE; i++)
+        if (_writes[i] > worst)
+          worst = _writes[i];
+      return worst;
+    }
+};
+
+extern HostEEPROM EEPROM;
+
+// Same name and meaning as the avr-libc macro
+#define eeprom_is_ready() (EEPROM.hostIsReady())
+
+#endif
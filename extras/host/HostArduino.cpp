@@ -0,0 +1,225 @@
+/**
+ * @file HostArduino.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of the host Arduino core (virtual clock, pins, ADC).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "Arduino.h"
+#include "EEPROM.h"
+
+HostSerial Serial;
+HostEEPROM EEPROM;
+
+static uint64_t g_micros = 0;
+
+static uint8_t g_pinMode[HOST_NUM_PINS];
+static uint8_t g_pinLevel[HOST_NUM_PINS];
+static int g_analog[256];
+static int g_analogOut[HOST_NUM_PINS];
+static unsigned long g_pulseWidth[HOST_NUM_PINS];
+static unsigned long g_analogCost = 0;
+static unsigned long g_analogReads = 0;
+static int (*g_analogHook)(uint8_t pin) = NULL;
+
+static void (*g_isr[HOST_NUM_PINS])();
+static int g_isrMode[HOST_NUM_PINS];
+
+static char g_serialIn[256];
+static int g_serialHead = 0;
+static int g_serialLen = 0;
+
+// =============================================================================
+// TIME
+// =============================================================================
+
+unsigned long millis() {
+  return (unsigned long)(uint32_t)(g_micros / 1000);
+}
+
+unsigned long micros() {
+  // Truncate to 32 bits like real cores, so wrap-around code paths are exercised
+  return (unsigned long)(uint32_t)g_micros;
+}
+
+void delay(unsigned long ms) {
+  g_micros += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+  g_micros += us;
+}
+
+void hostSetMicros(uint64_t us) {
+  g_micros = us;
+}
+
+void hostAdvanceMicros(uint64_t us) {
+  g_micros += us;
+}
+
+uint64_t hostMicros() {
+  return g_micros;
+}
+
+// =============================================================================
+// DIGITAL / ANALOG I/O
+// =============================================================================
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin >= HOST_NUM_PINS)
+    return;
+  g_pinMode[pin] = mode;
+  if (mode == INPUT_PULLUP)
+    g_pinLevel[pin] = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin < HOST_NUM_PINS)
+    g_pinLevel[pin] = val ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= HOST_NUM_PINS)
+    return LOW;
+  return g_pinLevel[pin];
+}
+
+int analogRead(uint8_t pin) {
+  g_micros += g_analogCost; // Blocked for the conversion
+  g_analogReads++;
+  if (g_analogHook != NULL)
+    return g_analogHook(pin);
+  return g_analog[pin];
+}
+
+void analogWrite(uint8_t pin, int val) {
+  if (pin < HOST_NUM_PINS)
+    g_analogOut[pin] = val;
+}
+
+unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout) {
+  (void)state;
+  unsigned long width = (pin < HOST_NUM_PINS) ? g_pulseWidth[pin] : 0;
+  if (width == 0 || width > timeout)
+  {
+    g_micros += timeout; // Blocked for the whole timeout
+    return 0;
+  }
+  g_micros += width;
+  return width;
+}
+
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(), int mode) {
+  if (interruptNum >= HOST_NUM_PINS)
+    return;
+  g_isr[interruptNum] = userFunc;
+  g_isrMode[interruptNum] = mode;
+}
+
+void detachInterrupt(uint8_t interruptNum) {
+  if (interruptNum < HOST_NUM_PINS)
+    g_isr[interruptNum] = NULL;
+}
+
+void hostSetPin(uint8_t pin, int level) {
+  if (pin >= HOST_NUM_PINS)
+    return;
+  int old = g_pinLevel[pin];
+  g_pinLevel[pin] = level ? HIGH : LOW;
+
+  if (g_isr[pin] == NULL || old == g_pinLevel[pin])
+    return;
+  int mode = g_isrMode[pin];
+  if (mode == CHANGE || (mode == RISING && level) || (mode == FALLING && !level))
+    g_isr[pin]();
+}
+
+int hostGetPin(uint8_t pin) {
+  return digitalRead(pin);
+}
+
+void hostSetAnalog(uint8_t pin, int value) {
+  g_analog[pin] = value;
+}
+
+void hostSetAnalogCost(unsigned long us) {
+  g_analogCost = us;
+}
+
+void hostSetAnalogHook(int (*hook)(uint8_t pin)) {
+  g_analogHook = hook;
+}
+
+unsigned long hostAnalogReads() {
+  return g_analogReads;
+}
+
+int hostGetAnalogWrite(uint8_t pin) {
+  if (pin >= HOST_NUM_PINS)
+    return 0;
+  return g_analogOut[pin];
+}
+
+void hostSetPulseWidth(uint8_t pin, unsigned long us) {
+  if (pin < HOST_NUM_PINS)
+    g_pulseWidth[pin] = us;
+}
+
+// =============================================================================
+// MATH / RANDOM
+// =============================================================================
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+long random(long howBig) {
+  if (howBig <= 0)
+    return 0;
+  return rand() % howBig;
+}
+
+long random(long howSmall, long howBig) {
+  if (howSmall >= howBig)
+    return howSmall;
+  return howSmall + random(howBig - howSmall);
+}
+
+void randomSeed(unsigned long seed) {
+  srand((unsigned int)seed);
+}
+
+// =============================================================================
+// SERIAL INPUT
+// =============================================================================
+
+int HostSerial::available() {
+  return g_serialLen - g_serialHead;
+}
+
+int HostSerial::read() {
+  if (g_serialHead >= g_serialLen)
+    return -1;
+  return (unsigned char)g_serialIn[g_serialHead++];
+}
+
+void hostSerialFeed(const char* text) {
+  int n = (int)strlen(text);
+
+  // Compact what is left, then append
+  memmove(g_serialIn, g_serialIn + g_serialHead, g_serialLen - g_serialHead);
+  g_serialLen -= g_serialHead;
+  g_serialHead = 0;
+  if (g_serialLen + n > (int)sizeof(g_serialIn))
+    n = (int)sizeof(g_serialIn) - g_serialLen;
+  memcpy(g_serialIn + g_serialLen, text, n);
+  g_serialLen += n;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file PidTuner.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Parallel Kp/Ki/Kd Grid Search for FastPID on the Host.
+ * Every candidate is an independent closed-loop simulation of the motor
+ * plant, driven by the exact FastPID::compute() that ships on the robot.
+ * Each simulation owns a virtual clock and passes it to compute() as an
+ * explicit timestamp, so thousands of them can run concurrently.
+ *
+ * Usage: pid_tuner [kpMin kpMax kpN  kiMin kiMax kiN  kdMin kdMax kdN  [threads]]
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <Arduino.h>
+#include "Utils/FastPID.h"
+#include "Plants.h"
+#include "SimMetrics.h"
+#include "WorkStealingPool.h"
+
+#include <algorithm>
+#include <vector>
+
+#define TUNE_PLANT_DT_US 100
+#define TUNE_CTRL_DT_US  1000
+#define TUNE_SECONDS     1.0f
+#define TUNE_TARGET      150.0f
+#define TUNE_PWM_MAX     255.0f
+
+/**
+ * @brief One grid point and its scores (lower is better for all three).
+ */
+struct Candidate {
+  float kp, ki, kd;
+  float itae;
+  float overshoot;
+  float saturation;
+  float settling;
+  bool stable;
+};
+
+/**
+ * @brief Inclusive linear range split into n points.
+ */
+struct Range {
+  float lo, hi;
+  int n;
+  float at(int i) const { return (n <= 1) ? lo : lo + (hi - lo) * (float)i / (float)(n - 1); }
+};
+
+/**
+ * @brief Closed-loop motor step response with a private virtual clock.
+ */
+static void simulate(Candidate& c) {
+  FastPID pid(c.kp, c.ki, c.kd, 0);
+  DcMotorPlant motor;
+  BatteryPlant battery;
+  StepMetrics metrics(0.0f, TUNE_TARGET);
+  unsigned long now = 0; // Virtual microseconds (thread-local by construction)
+  unsigned long steps = (unsigned long)(TUNE_SECONDS * 1e6f / TUNE_PLANT_DT_US);
+  float pwm = 0.0f;
+  unsigned long k;
+
+  pid.setOutputLimits(-TUNE_PWM_MAX, TUNE_PWM_MAX);
+  pid.setSampleTime(TUNE_CTRL_DT_US, PID_TIMEBASE_MICROS);
+
+  c.stable = true;
+  k = 0;
+  while (k < steps)
+  {
+    if ((k * TUNE_PLANT_DT_US) % TUNE_CTRL_DT_US == 0)
+      pwm = pid.compute(TUNE_TARGET, motor.speed(), now);
+
+    float dt = TUNE_PLANT_DT_US * 1e-6f;
+    motor.step(pwm / TUNE_PWM_MAX * battery.voltage(), dt);
+    battery.step(fabsf(motor.current()), dt);
+    now += TUNE_PLANT_DT_US;
+
+    float y = motor.speed();
+    if (!(fabsf(y) < 1e6f))
+    {
+      c.stable = false;
+      break;
+    }
+    metrics.add(now * 1e-6f, y, fabsf(pwm) >= TUNE_PWM_MAX);
+    k++;
+  }
+
+  c.itae = metrics.itae();
+  c.overshoot = metrics.overshoot();
+  c.saturation = metrics.saturationTime();
+  c.settling = metrics.settlingTime();
+  if (c.settling < 0.0f)
+    c.stable = false; // Never settled inside the band: oscillating or too slow
+}
+
+/**
+ * @brief a dominates b if it is no worse on every objective and better on one.
+ */
+static bool dominates(const Candidate& a, const Candidate& b) {
+  bool noWorse = a.itae <= b.itae && a.overshoot <= b.overshoot && a.saturation <= b.saturation;
+  bool better = a.itae < b.itae || a.overshoot < b.overshoot || a.saturation < b.saturation;
+  return noWorse && better;
+}
+
+static void printCandidate(const Candidate& c) {
+  printf("  Kp %8.4f  Ki %8.5f  Kd %8.4f | ITAE %8.5f  overshoot %6.2f %%  sat %6.3f s  settle %6.4f s\n",
+         c.kp, c.ki, c.kd, c.itae, c.overshoot, c.saturation, c.settling);
+}
+
+int main(int argc, char** argv) {
+  Range kp = {0.5f, 6.0f, 16};
+  Range ki = {0.0f, 0.2f, 16};
+  Range kd = {0.0f, 2.0f, 16};
+  unsigned threads = 0;
+
+  if (argc >= 10)
+  {
+    kp.lo = atof(argv[1]); kp.hi = atof(argv[2]); kp.n = atoi(argv[3]);
+    ki.lo = atof(argv[4]); ki.hi = atof(argv[5]); ki.n = atoi(argv[6]);
+    kd.lo = atof(argv[7]); kd.hi = atof(argv[8]); kd.n = atoi(argv[9]);
+    if (argc >= 11)
+      threads = (unsigned)atoi(argv[10]);
+  }
+
+  // 1. Build the grid
+  std::vector<Candidate> grid;
+  int a, b, d;
+  for (a = 0; a < kp.n; a++)
+    for (b = 0; b < ki.n; b++)
+      for (d = 0; d < kd.n; d++)
+      {
+        Candidate c = {kp.at(a), ki.at(b), kd.at(d), 0.0f, 0.0f, 0.0f, 0.0f, false};
+        grid.push_back(c);
+      }
+
+  // 2. Simulate every candidate across all cores
+  WorkStealingPool pool(threads);
+  std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  pool.run(grid.size(), [&grid](size_t i) { simulate(grid[i]); });
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+  // 3. Keep stable candidates, extract the Pareto set
+  std::vector<Candidate> stable;
+  size_t i, j;
+  for (i = 0; i < grid.size(); i++)
+    if (grid[i].stable)
+      stable.push_back(grid[i]);
+
+  std::vector<Candidate> pareto;
+  for (i = 0; i < stable.size(); i++)
+  {
+    bool dominated = false;
+    for (j = 0; j < stable.size() && !dominated; j++)
+      dominated = (j != i) && dominates(stable[j], stable[i]);
+    if (!dominated)
+      pareto.push_back(stable[i]);
+  }
+  std::sort(pareto.begin(), pareto.end(),
+            [](const Candidate& x, const Candidate& y) { return x.itae < y.itae; });
+
+  printf("PID gain sweep: %zu candidates (%zu stable) on %u threads in %.2f s"
+         " (%.1f simulated s per wall s)\n",
+         grid.size(), stable.size(), pool.threads(), wall,
+         grid.size() * TUNE_SECONDS / (wall > 0.0 ? wall : 1.0));
+  printf("Pareto set (ITAE, overshoot, saturation time), %zu candidates, best ITAE first:\n", pareto.size());
+  for (i = 0; i < pareto.size(); i++)
+    printCandidate(pareto[i]);
+  simExpect(!pareto.empty(), "at least one stable candidate");
+  return simExitCode();
+}
@@ -0,0 +1,195 @@
+/**
+ * @file Plants.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Plant Models for Closed-Loop Host Simulation.
+ * DC motor, differential-drive chassis and battery with internal resistance.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef HOST_PLANTS_H
+#define HOST_PLANTS_H
+
+#include <math.h>
+
+/**
+ * @brief Battery pack: open-circuit voltage falls with state of charge,
+ * terminal voltage sags with load current (V = Voc - I * R).
+ */
+class BatteryPlant {
+  private:
+    float _vFull;      // Open-circuit voltage at 100%
+    float _vEmpty;     // Open-circuit voltage at 0%
+    float _rInternal;  // Ohm
+    float _capacity;   // Coulomb
+    float _soc;        // 0..1
+    float _current;    // Last load current (A)
+
+  public:
+    /**
+     * @param vFull Voltage at 100% (e.g. 12.6 for 3S LiPo).
+     * @param vEmpty Voltage at 0% (e.g. 10.5).
+     * @param rInternal Internal resistance in Ohm.
+     * @param capacityAh Capacity in Ah.
+     */
+    BatteryPlant(float vFull = 12.6, float vEmpty = 10.5, float rInternal = 0.05, float capacityAh = 2.2) {
+      _vFull = vFull;
+      _vEmpty = vEmpty;
+      _rInternal = rInternal;
+      _capacity = capacityAh * 3600.0f;
+      _soc = 1.0f;
+      _current = 0.0f;
+    }
+
+    void setCharge(float soc) { _soc = soc; }
+
+    /**
+     * @brief Draws current for dt seconds.
+     */
+    void step(float current, float dt) {
+      _current = current;
+      _soc -= current * dt / _capacity;
+      if (_soc < 0.0f)
+        _soc = 0.0f;
+      if (_soc > 1.0f)
+        _soc = 1.0f;
+    }
+
+    float openCircuitVoltage() const {
+      // Flat middle, steeper knee near empty (rough LiPo shape)
+      float knee = (_soc < 0.2f) ? (0.2f - _soc) * 2.0f : 0.0f;
+      return _vEmpty + (_vFull - _vEmpty) * (_soc - knee * 0.1f);
+    }
+
+    float voltage() const { return openCircuitVoltage() - _current * _rInternal; }
+    float charge() const { return _soc; }
+    float current() const { return _current; }
+};
+
+/**
+ * @brief Brushed DC motor: electrical (R, L, back-EMF) plus mechanical
+ * (inertia, viscous friction, load torque) dynamics.
+ */
+class DcMotorPlant {
+  private:
+    float _r, _l;      // Ohm, Henry
+    float _kt, _ke;    // Nm/A, V*s/rad
+    float _j, _b;      // kg*m^2, Nm*s/rad
+    float _load;       // Nm (opposes motion)
+    float _i;          // A
+    float _w;          // rad/s
+    float _theta;      // rad
+
+  public:
+    /**
+     * @brief Defaults approximate a small 12 V geared hobby motor (output shaft).
+     */
+    DcMotorPlant(float r = 2.0, float l = 0.002, float kt = 0.05, float ke = 0.05,
+                 float j = 0.00005, float b = 0.00002) {
+      _r = r;
+      _l = l;
+      _kt = kt;
+      _ke = ke;
+      _j = j;
+      _b = b;
+      _load = 0.0f;
+      reset();
+    }
+
+    void reset() {
+      _i = 0.0f;
+      _w = 0.0f;
+      _theta = 0.0f;
+    }
+
+    void setLoadTorque(float nm) { _load = nm; }
+
+    /**
+     * @brief Integrates the motor for dt seconds at a given terminal voltage.
+     * Uses internal sub-steps so the fast electrical pole stays stable.
+     */
+    void step(float voltage, float dt) {
+      float tauE = _l / _r;
+      int n = (int)(dt / (tauE * 0.5f)) + 1;
+      float h = dt / (float)n;
+      int k;
+
+      k = 0;
+      while (k < n)
+      {
+        float di = (voltage - _r * _i - _ke * _w) / _l;
+        _i += di * h;
+
+        // Coulomb-style load always opposes rotation (and cannot reverse it)
+        float load = (_w > 0.0f) ? _load : ((_w < 0.0f) ? -_load : 0.0f);
+        float torque = _kt * _i - _b * _w - load;
+        if (_w == 0.0f && fabsf(_kt * _i) <= _load)
+          torque = 0.0f;
+        _w += (torque / _j) * h;
+        _theta += _w * h;
+        k++;
+      }
+    }
+
+    float speed() const { return _w; }        // rad/s
+    float position() const { return _theta; } // rad
+    float current() const { return _i; }      // A
+};
+
+/**
+ * @brief Two-wheeled chassis: two DC motors, unicycle pose integration.
+ */
+class DiffDriveChassis {
+  private:
+    float _wheelRadius; // m
+    float _trackWidth;  // m
+    float _x, _y, _theta;
+
+  public:
+    DcMotorPlant left;
+    DcMotorPlant right;
+
+    DiffDriveChassis(float wheelRadius = 0.033, float trackWidth = 0.16) {
+      _wheelRadius = wheelRadius;
+      _trackWidth = trackWidth;
+      _x = 0.0f;
+      _y = 0.0f;
+      _theta = 0.0f;
+      left.setLoadTorque(0.002f);
+      right.setLoadTorque(0.002f);
+    }
+
+    /**
+     * @brief Applies wheel voltages for dt seconds and integrates the pose.
+     */
+    void step(float vLeft, float vRight, float dt) {
+      left.step(vLeft, dt);
+      right.step(vRight, dt);
+
+      float vl = left.speed() * _wheelRadius;
+      float vr = right.speed() * _wheelRadius;
+      float v = 0.5f * (vl + vr);
+      float w = (vr - vl) / _trackWidth;
+
+      // Midpoint heading (second order)
+      float mid = _theta + 0.5f * w * dt;
+      _x += v * cosf(mid) * dt;
+      _y += v * sinf(mid) * dt;
+      _theta += w * dt;
+    }
+
+    float x() const { return _x; }
+    float y() const { return _y; }
+    float heading() const { return _theta; }
+    float linearSpeed() const { return 0.5f * (left.speed() + right.speed()) * _wheelRadius; }
+    float angularSpeed() const { return (right.speed() - left.speed()) * _wheelRadius / _trackWidth; }
+    float totalCurrent() const { return fabsf(left.current()) + fabsf(right.current()); }
+};
+
+#endif
@@ -0,0 +1,1354 @@
+/**
+ * @file RobotisSim.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Closed-Loop Host Simulation of FastPID and DiffDrive.
+ * Runs the real library classes against plant models on a virtual clock
+ * and reports settling time, overshoot and controller CPU cost per step.
+ * FixedPID is checked against FastPID on identical inputs, MultiPID
+ * against independent controllers, with its cost per axis against N.
+ * The DiffDrive mixer is checked against a float reference and timed
+ * against the previous map()-based mixer. SlewLimiter is held to its rate
+ * and jerk bounds, MotionProfile to its limits and end states, and
+ * DiffDrive::computeVelocity to the wheel kinematics.
+ * Also drives QuadEncoder from a simulated edge generator and checks the
+ * fixed-point Odometry for drift against a double-precision reference,
+ * and TickClock's 64-bit extension across a source wrap. A 10k-timer
+ * TimerWheel workload is checked against an exact fire histogram, and
+ * Callback call cost is compared with a raw function pointer. WindowStats
+ * is checked against a brute-force recomputation over random streams.
+ *
+ * Usage: robotis_sim [kp ki kd]
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <Arduino.h>
+#include "RobotisTools.h"
+#include "Plants.h"
+#include "SimMetrics.h"
+
+#include <string.h>
+
+#define SIM_PLANT_DT_US   100  // Plant integration step
+#define SIM_CTRL_DT_US    1000 // Controller sample time (1 kHz)
+#define SIM_PWM_MAX       255.0f
+
+static float g_kp = 2.0f;
+static float g_ki = 0.06f;
+static float g_kd = 0.5f;
+
+// Controller output as float, whatever the PID's numeric type
+static float toFloat(float v) { return v; }
+template <int F> static float toFloat(FixedPoint<F> v) { return v.toFloat(); }
+
+/**
+ * @brief Prints one result line.
+ */
+static void report(const char* name, const StepMetrics& m, const CpuMeter& cpu,
+                   double simSeconds, double wallSeconds) {
+  printf("%-22s overshoot %6.2f %%  rise %7.4f s  settle %7.4f s  ITAE %8.4f  sat %6.3f s"
+         "  ctrl %6.1f ns/step  x%.0f real time\n",
+         name, m.overshoot(), m.riseTime(), m.settlingTime(), m.itae(), m.saturationTime(),
+         cpu.nsPerCall(), wallSeconds > 0.0 ? simSeconds / wallSeconds : 0.0);
+}
+
+/**
+ * @brief Motor speed loop: controller -> PWM -> battery-fed DC motor.
+ */
+template <class PID>
+static void runMotorStep(const char* name, PID& pid, float target, float seconds) {
+  DcMotorPlant motor;
+  BatteryPlant battery;
+  StepMetrics metrics(0.0f, target);
+  CpuMeter cpu;
+  float pwm = 0.0f;
+  unsigned long steps = (unsigned long)(seconds * 1e6f / SIM_PLANT_DT_US);
+  unsigned long k;
+
+  hostSetMicros(0);
+  pid.setOutputLimits(-SIM_PWM_MAX, SIM_PWM_MAX);
+  pid.setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+
+  std::chrono::steady_clock::time_point w0 = std::chrono::steady_clock::now();
+  k = 0;
+  while (k < steps)
+  {
+    if ((k * SIM_PLANT_DT_US) % SIM_CTRL_DT_US == 0)
+    {
+      cpu.start();
+      pwm = toFloat(pid.compute(target, motor.speed(), micros()));
+      cpu.stop();
+    }
+
+    float volts = pwm / SIM_PWM_MAX * battery.voltage();
+    float dt = SIM_PLANT_DT_US * 1e-6f;
+    motor.step(volts, dt);
+    battery.step(fabsf(motor.current()), dt);
+    hostAdvanceMicros(SIM_PLANT_DT_US);
+
+    metrics.add(hostMicros() * 1e-6f, motor.speed(), fabsf(pwm) >= SIM_PWM_MAX);
+    k++;
+  }
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - w0).count();
+  report(name, metrics, cpu, seconds, wall);
+  simExpect(metrics.settlingTime() >= 0.0f && metrics.settlingTime() < 0.5f, "motor step settles within 0.5 s");
+  simExpect(metrics.overshoot() < 10.0f, "motor step overshoot < 10 %");
+}
+
+/**
+ * @brief FixedPID against FastPID on identical inputs. The float loop
+ * drives the motor; both controllers see the same setpoint, measurement
+ * (with sensor noise) and jittered timestamps, so any output difference
+ * is Q16.16 rounding of gains, dt ratios and the integral. Setpoint steps
+ * and a load change exercise saturation and the windup guard.
+ */
+#define SIM_FIXED_TOLERANCE 0.05f // PWM counts of 255 (1/20 of a count)
+
+static void runFixedVsFloat(unsigned long dFilterTau, float seconds) {
+  DcMotorPlant motor;
+  FastPID floatPID(g_kp, g_ki, g_kd, 1);
+  FixedPID fixedPID(g_kp, g_ki, g_kd, 1);
+  CpuMeter floatCpu, fixedCpu;
+  float pwm = 0.0f, worst = 0.0f, sum = 0.0f;
+  unsigned long steps = (unsigned long)(seconds * 1e6f / SIM_PLANT_DT_US);
+  unsigned long k, nextCtrl = 0, samples = 0;
+
+  srand(23);
+  hostSetMicros(0);
+  floatPID.setOutputLimits(-SIM_PWM_MAX, SIM_PWM_MAX);
+  fixedPID.setOutputLimits(-SIM_PWM_MAX, SIM_PWM_MAX);
+  floatPID.setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+  fixedPID.setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+  floatPID.setDerivativeFilter(dFilterTau);
+  fixedPID.setDerivativeFilter(dFilterTau);
+
+  k = 0;
+  while (k < steps)
+  {
+    unsigned long now = micros();
+    float t = now * 1e-6f;
+    motor.setLoadTorque(t > seconds * 0.5f ? 0.02f : 0.0f);
+    if (now >= nextCtrl)
+    {
+      float target = (t < seconds * 0.25f) ? 150.0f : ((t < seconds * 0.75f) ? -80.0f : 40.0f);
+      float speed = motor.speed() + 0.5f * (rand() / (float)RAND_MAX - 0.5f);
+
+      floatCpu.start();
+      pwm = floatPID.compute(target, speed, now);
+      floatCpu.stop();
+      fixedCpu.start();
+      Q16_16 fixedOut = fixedPID.compute(Q16_16(target), Q16_16(speed), now);
+      fixedCpu.stop();
+
+      float diff = fabsf(fixedOut.toFloat() - pwm);
+      sum += diff;
+      if (diff > worst)
+        worst = diff;
+      samples++;
+      nextCtrl = now + SIM_CTRL_DT_US - 200 + 100 * (rand() % 5); // 0.8 .. 1.2 ms
+    }
+
+    motor.step(pwm / SIM_PWM_MAX * 12.0f, SIM_PLANT_DT_US * 1e-6f);
+    hostAdvanceMicros(SIM_PLANT_DT_US);
+    k++;
+  }
+
+  printf("FixedPID vs FastPID  D filter %4lu us  %lu computes: output diff mean %.4f  worst %.4f"
+         " (tolerance %.2f of %.0f)  compute float %.1f ns  fixed %.1f ns\n",
+         dFilterTau, samples, sum / samples, worst, SIM_FIXED_TOLERANCE, SIM_PWM_MAX,
+         floatCpu.nsPerCall(), fixedCpu.nsPerCall());
+  simExpect(worst <= SIM_FIXED_TOLERANCE, "FixedPID output within tolerance of FastPID");
+}
+
+/**
+ * @brief The narrow FixedPoint paths used on AVR / Cortex-M0 against the
+ * 64-bit reference: fixedMulWide() over random and extreme operands, and
+ * the 32-bit ratio() over PID-sized tick counts and around the 2^(32-F)
+ * denominator limit. Both must be exact.
+ */
+static uint32_t randomWord() {
+  return ((uint32_t)(rand() & 0xFFFF) << 16) ^ (uint32_t)(rand() & 0xFFFF);
+}
+
+template <int F>
+static unsigned long checkRatio(unsigned long num, unsigned long den) {
+  int32_t want = (int32_t)(((uint64_t)num << F) / den);
+  uint64_t wide = ((uint64_t)num << F) / den;
+  if (wide > (uint64_t)FIXED_RAW_MAX)
+    want = FIXED_RAW_MAX;
+  return (FixedPoint<F>::ratio(num, den).raw() != want) ? 1 : 0;
+}
+
+static void runFixedPointOps() {
+  static const int32_t edges[8] = {0, 1, -1, 65535, -65536, FIXED_RAW_MAX, FIXED_RAW_MIN, 0x12345678};
+  unsigned long k, mulWrong = 0, ratioWrong = 0;
+  int i, j;
+
+  srand(31);
+  for (i = 0; i < 8; i++)
+    for (j = 0; j < 8; j++)
+      if (fixedMulWide(edges[i], edges[j]) != (int64_t)edges[i] * edges[j])
+        mulWrong++;
+  k = 0;
+  while (k < 1000000)
+  {
+    int32_t a = (int32_t)randomWord(), b = (int32_t)randomWord();
+    if (fixedMulWide(a, b) != (int64_t)a * b)
+      mulWrong++;
+
+    unsigned long dt = 800 + rand() % 400;   // Jittered 1 ms sample
+    unsigned long ts = 1 + rand() % 20000;
+    ratioWrong += checkRatio<16>(dt, ts) + checkRatio<16>(ts, dt);
+    ratioWrong += checkRatio<16>(randomWord(), 1 + rand() % 70000);
+    ratioWrong += checkRatio<24>(rand() % 1000, 1 + rand() % 300);
+    ratioWrong += checkRatio<16>(randomWord(), 65535 + rand() % 3);
+    k++;
+  }
+
+  printf("FixedPoint narrow paths, 1M random cases: fixedMulWide wrong %lu  32-bit ratio() wrong %lu\n",
+         mulWrong, ratioWrong);
+  simExpect(mulWrong == 0, "fixedMulWide equals the 64-bit product");
+  simExpect(ratioWrong == 0, "32-bit ratio() equals the 64-bit division");
+}
+
+/**
+ * @brief A stall of 100 sample times (e.g. a blocking EEPROM write) with
+ * a constant error of 1 and ki = 1: the integral may grow by at most
+ * PID_MAX_DT_RATIO, and a slightly late call (1.5 Ts) must still be
+ * scaled exactly.
+ */
+template <class PID>
+static float lateSampleIntegral(PID& pid, unsigned long stall) {
+  pid.setOutputLimits(-1000.0f, 1000.0f);
+  pid.setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+  pid.compute(1.0f, 0.0f, 0);                            // Integral 1
+  pid.compute(1.0f, 0.0f, SIM_CTRL_DT_US);                // 2
+  float before = toFloat(pid.compute(1.0f, 0.0f, 2 * SIM_CTRL_DT_US)); // 3
+  return toFloat(pid.compute(1.0f, 0.0f, 2 * SIM_CTRL_DT_US + stall)) - before;
+}
+
+static void runLateSample() {
+  FastPID floatPID(0.0f, 1.0f, 0.0f, 1);
+  FixedPID fixedPID(0.0f, 1.0f, 0.0f, 1);
+  FastPID slightly(0.0f, 1.0f, 0.0f, 1);
+  MultiPID<2> multi(SIM_CTRL_DT_US);
+  float setpoints[2] = {1.0f, 1.0f}, inputs[2] = {0.0f, 0.0f};
+  unsigned long stall = 100 * SIM_CTRL_DT_US;
+
+  float stepFloat = lateSampleIntegral(floatPID, stall);
+  float stepFixed = lateSampleIntegral(fixedPID, stall);
+  float stepSlight = lateSampleIntegral(slightly, SIM_CTRL_DT_US * 3 / 2);
+
+  multi.setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+  multi.setTunings(0, 0.0f, 1.0f, 0.0f);
+  multi.setTunings(1, 0.0f, 1.0f, 0.0f);
+  multi.setOutputLimits(0, -1000.0f, 1000.0f);
+  multi.compute(setpoints, inputs, 0);
+  multi.compute(setpoints, inputs, SIM_CTRL_DT_US);
+  float before = multi.getOutput(0);
+  multi.compute(setpoints, inputs, SIM_CTRL_DT_US + stall);
+  float stepMulti = multi.getOutput(0) - before;
+
+  printf("Late sample after a %lu Ts stall, ki 1, error 1: integral step FastPID %.2f  FixedPID %.2f"
+         "  MultiPID %.2f (cap %d)  1.5 Ts late: %.3f\n",
+         stall / SIM_CTRL_DT_US, stepFloat, stepFixed, stepMulti, PID_MAX_DT_RATIO, stepSlight);
+  simExpect(stepFloat == (float)PID_MAX_DT_RATIO && stepFixed == (float)PID_MAX_DT_RATIO &&
+            stepMulti == (float)PID_MAX_DT_RATIO, "late sample integrates at most PID_MAX_DT_RATIO");
+  simExpect(fabsf(stepSlight - 1.5f) < 1e-4f, "slightly late sample is scaled by dt / Ts");
+}
+
+/**
+ * @brief MultiPID<N, T> against N independent BasicFastPID<T> with random
+ * per-axis gains and limits, random setpoints and measurements and
+ * jittered timestamps. Every output must match exactly (same operation
+ * order), with and without the derivative filter.
+ */
+template <int N, class T>
+static unsigned long checkMultiPID(unsigned long dFilterTau, unsigned long calls) {
+  MultiPID<N, T> multi(SIM_CTRL_DT_US);
+  BasicFastPID<T>* single[N];
+  T setpoints[N], inputs[N];
+  unsigned long k, now = 0, mismatches = 0;
+  int i;
+
+  srand(29);
+  multi.setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+  multi.setDerivativeFilter(dFilterTau);
+  i = 0;
+  while (i < N)
+  {
+    float kp = 0.5f + 4.0f * rand() / (float)RAND_MAX;
+    float ki = 0.2f * rand() / (float)RAND_MAX;
+    float kd = 2.0f * rand() / (float)RAND_MAX;
+    float limit = 50.0f + 200.0f * rand() / (float)RAND_MAX;
+    single[i] = new BasicFastPID<T>(T(kp), T(ki), T(kd), SIM_CTRL_DT_US);
+    single[i]->setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+    single[i]->setDerivativeFilter(dFilterTau);
+    single[i]->setOutputLimits(T(-limit), T(limit));
+    multi.setTunings(i, T(kp), T(ki), T(kd));
+    multi.setOutputLimits(i, T(-limit), T(limit));
+    i++;
+  }
+
+  k = 0;
+  while (k < calls)
+  {
+    now += SIM_CTRL_DT_US - 300 + rand() % 600; // Late and early calls
+    i = 0;
+    while (i < N)
+    {
+      setpoints[i] = T((float)(rand() % 400 - 200));
+      inputs[i] = T((float)(rand() % 400 - 200) + rand() / (float)RAND_MAX);
+      i++;
+    }
+    bool ran = multi.compute(setpoints, inputs, now);
+    i = 0;
+    while (i < N)
+    {
+      T out = single[i]->compute(setpoints[i], inputs[i], now);
+      if (ran && !(out == multi.getOutput(i)))
+        mismatches++;
+      i++;
+    }
+    k++;
+  }
+
+  i = 0;
+  while (i < N)
+  {
+    delete single[i];
+    i++;
+  }
+  return mismatches;
+}
+
+/**
+ * @brief Host time per axis of one MultiPID<N> compute against N
+ * FastPID computes, same inputs and timestamps.
+ */
+template <int N>
+static void timeMultiPID() {
+  const unsigned long calls = 200000;
+  MultiPID<N> multi(SIM_CTRL_DT_US);
+  FastPID* single[N];
+  float setpoints[N], inputs[N];
+  CpuMeter multiCpu, singleCpu;
+  volatile float sink = 0.0f; // Keeps the computes from being optimized out
+  unsigned long k, now = 0;
+  int i;
+
+  multi.setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+  i = 0;
+  while (i < N)
+  {
+    single[i] = new FastPID(g_kp, g_ki, g_kd, SIM_CTRL_DT_US);
+    single[i]->setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+    multi.setTunings(i, g_kp, g_ki, g_kd);
+    setpoints[i] = 100.0f + i;
+    inputs[i] = 0.0f;
+    i++;
+  }
+
+  multiCpu.start();
+  k = 0;
+  while (k < calls)
+  {
+    now += SIM_CTRL_DT_US;
+    inputs[k % N] += 0.25f;
+    multi.compute(setpoints, inputs, now);
+    const float* out = multi.getOutputs();
+    float sum = 0.0f;
+    i = 0;
+    while (i < N)
+    {
+      sum += out[i];
+      i++;
+    }
+    sink = sink + sum;
+    k++;
+  }
+  multiCpu.stop();
+
+  now = 0;
+  singleCpu.start();
+  k = 0;
+  while (k < calls)
+  {
+    now += SIM_CTRL_DT_US;
+    inputs[k % N] -= 0.25f;
+    float sum = 0.0f;
+    i = 0;
+    while (i < N)
+    {
+      sum += single[i]->compute(setpoints[i], inputs[i], now);
+      i++;
+    }
+    sink = sink + sum;
+    k++;
+  }
+  singleCpu.stop();
+
+  double multiNs = multiCpu.nsPerCall() / calls / N;
+  double singleNs = singleCpu.nsPerCall() / calls / N;
+  printf("  N %2d: MultiPID %5.2f ns/axis  %2d x FastPID %5.2f ns/axis\n", N,
+         multiNs, N, singleNs);
+  simExpect(multiNs > 0.5 && singleNs > 0.5, "PID timing loops are not optimized away");
+  i = 0;
+  while (i < N)
+  {
+    delete single[i];
+    i++;
+  }
+}
+
+static void runMultiPID() {
+  unsigned long floatOff = checkMultiPID<6, float>(0, 20000);
+  unsigned long floatOn = checkMultiPID<6, float>(1500, 20000);
+  unsigned long fixedOff = checkMultiPID<6, Q16_16>(0, 20000);
+  unsigned long fixedOn = checkMultiPID<6, Q16_16>(1500, 20000);
+
+  printf("MultiPID<6> vs 6 independent controllers, 20000 jittered calls: mismatched outputs"
+         "  float %lu / %lu (D filter off / on)  Q16.16 %lu / %lu\n",
+         floatOff, floatOn, fixedOff, fixedOn);
+  simExpect(floatOff == 0 && floatOn == 0 && fixedOff == 0 && fixedOn == 0,
+            "MultiPID axes match independent controllers exactly");
+
+  printf("MultiPID cost per axis vs N (host ns):\n");
+  timeMultiPID<1>();
+  timeMultiPID<2>();
+  timeMultiPID<4>();
+  timeMultiPID<8>();
+  timeMultiPID<16>();
+  timeMultiPID<32>();
+}
+
+/**
+ * @brief The DiffDrive mixer before 1.2: map() of -200..200 onto
+ * -maxPWM..maxPWM and a clip per wheel. Kept here for comparison.
+ */
+static void legacyMix(int maxPWM, int x, int y, int* left, int* right) {
+  int rawLeft = y + x;
+  int rawRight = y - x;
+  *left = constrain((int)map(rawLeft, -200, 200, -maxPWM, maxPWM), -maxPWM, maxPWM);
+  *right = constrain((int)map(rawRight, -200, 200, -maxPWM, maxPWM), -maxPWM, maxPWM);
+}
+
+/**
+ * @brief DiffDrive::compute() over every stick position against a float
+ * reference of the ratio-preserving mix (within 1 PWM count), then the
+ * cost per call of the new mixer against the legacy map() mixer on the
+ * same random stick stream.
+ */
+static void runMixer(int maxPWM) {
+  const unsigned long calls = 4000000;
+  static int16_t sticks[4096][2];
+  DiffDrive mixer(maxPWM);
+  volatile long sink = 0;
+  int x, y, worst = 0, left, right;
+  unsigned long k;
+
+  // 1. Exhaustive check against the float reference
+  for (y = -100; y <= 100; y++)
+    for (x = -100; x <= 100; x++)
+    {
+      float l = (float)(y + x), r = (float)(y - x);
+      float mag = fabsf(l) > fabsf(r) ? fabsf(l) : fabsf(r);
+      if (mag > 100.0f)
+      {
+        l *= 100.0f / mag;
+        r *= 100.0f / mag;
+      }
+      mixer.compute(x, y);
+      int eL = abs(mixer.getLeft() - (int)lroundf(l * maxPWM / 100.0f));
+      int eR = abs(mixer.getRight() - (int)lroundf(r * maxPWM / 100.0f));
+      if (eL > worst)
+        worst = eL;
+      if (eR > worst)
+        worst = eR;
+    }
+
+  // 2. Cost per call, same inputs for both mixers
+  srand(31);
+  k = 0;
+  while (k < 4096)
+  {
+    sticks[k][0] = (int16_t)(rand() % 201 - 100);
+    sticks[k][1] = (int16_t)(rand() % 201 - 100);
+    k++;
+  }
+  uint64_t c0 = simCycles();
+  std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  k = 0;
+  while (k < calls)
+  {
+    mixer.compute(sticks[k & 4095][0], sticks[k & 4095][1]);
+    sink += mixer.getLeft() - mixer.getRight();
+    k++;
+  }
+  uint64_t c1 = simCycles();
+  std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+  k = 0;
+  while (k < calls)
+  {
+    legacyMix(maxPWM, sticks[k & 4095][0], sticks[k & 4095][1], &left, &right);
+    sink += left - right;
+    k++;
+  }
+  uint64_t c2 = simCycles();
+  std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+  mixer.compute(0, 100);
+  int fullL = mixer.getLeft();
+  legacyMix(maxPWM, 0, 100, &left, &right);
+  printf("DiffDrive max %4d: worst error vs float mix %d  full stick %d (legacy %d)"
+         "  per call: %.1f cycles %.2f ns (legacy map() %.1f cycles %.2f ns)\n",
+         maxPWM, worst, fullL, left, (double)(c1 - c0) / calls,
+         std::chrono::duration<double, std::nano>(t1 - t0).count() / calls,
+         (double)(c2 - c1) / calls, std::chrono::duration<double, std::nano>(t2 - t1).count() / calls);
+  simExpect(worst <= 1, "DiffDrive mix within 1 PWM count of the float reference");
+  simExpect(fullL == maxPWM, "full stick reaches maxPWM");
+}
+
+/**
+ * @brief One SlewLimiter under test; records the worst rate, rate change
+ * and step of every tick, each relative to its limit.
+ */
+struct SlewCheck {
+  SlewLimiter slew;
+  float maxRate, maxJerk, dt;
+  float worstRate, worstJerk, worstStep;
+
+  SlewCheck(float rate, float jerk, float tick) : slew(rate, jerk) {
+    maxRate = rate;
+    maxJerk = jerk;
+    dt = tick;
+    worstRate = worstJerk = worstStep = 0.0f;
+  }
+
+  float step(float target) {
+    float lastValue = slew.getValue(), lastRate = slew.getRate();
+    float value = slew.update(target, dt);
+    worstRate = fmaxf(worstRate, fabsf(slew.getRate()) / maxRate);
+    worstStep = fmaxf(worstStep, fabsf(value - lastValue) / (maxRate * dt));
+    if (maxJerk > 0.0f)
+      worstJerk = fmaxf(worstJerk, fabsf(slew.getRate() - lastRate) / (maxJerk * dt));
+    return value;
+  }
+
+  // Ticks until the limiter rests on the target; false if it never does
+  bool settle(float target, float* overshoot) {
+    float from = slew.getValue();
+    unsigned long n = 0;
+    while (slew.getValue() != target || slew.getRate() != 0.0f)
+    {
+      float value = step(target);
+      float over = (target >= from) ? value - target : target - value;
+      if (over > *overshoot)
+        *overshoot = over;
+      if (++n > 100000)
+        return false;
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief SlewLimiter at a 20 ms tick. Phase 1 jumps the target at random
+ * moments, moving or not; phase 2 starts every move from rest. Every tick
+ * must keep the rate within maxRate, its change within maxJerk * dt
+ * (S-curve) and the step within maxRate * dt. Moves from rest must come
+ * to rest exactly on the target, overshooting by no more than float
+ * rounding.
+ */
+static void runSlewLimiter(float maxJerk) {
+  SlewCheck check(0.5f, maxJerk, 0.02f);
+  float target = 0.0f, overshoot = 0.0f;
+  unsigned long k, missed = 0;
+  int hold = 0;
+
+  srand(29);
+  k = 0;
+  while (k < 200000)
+  {
+    if (hold == 0)
+    {
+      target = (rand() / (float)RAND_MAX - 0.5f) * 2.0f;
+      hold = 1 + rand() % 200;
+    }
+    check.step(target);
+    hold--;
+    k++;
+  }
+
+  float ignored = 0.0f;
+  if (!check.settle(target, &ignored))
+    missed++;
+  k = 0;
+  while (k < 2000)
+  {
+    target = (rand() / (float)RAND_MAX - 0.5f) * 2.0f;
+    if (!check.settle(target, &overshoot))
+      missed++;
+    k++;
+  }
+
+  printf("SlewLimiter rate 0.5 jerk %4.1f dt 20 ms: worst |rate| / max %.4f  |d rate| / (jerk dt) %.4f"
+         "  |step| / (rate dt) %.4f  from rest: overshoot %.2g  not reached %lu\n",
+         maxJerk, check.worstRate, check.worstJerk, check.worstStep, overshoot, missed);
+  simExpect(check.worstRate <= 1.0001f, "SlewLimiter rate within maxRate");
+  simExpect(check.worstStep <= 1.0001f, "SlewLimiter step within maxRate * dt");
+  simExpect(check.worstJerk <= 1.0001f, "SlewLimiter rate change within maxJerk * dt, landing included");
+  simExpect(overshoot < 1e-6f && missed == 0, "SlewLimiter lands exactly on a target held from rest");
+}
+
+/**
+ * @brief MotionProfile plans (long, short, very short, negative) sampled
+ * on a 1 ms grid: starts and ends at rest on the exact distance, stays
+ * within the velocity and acceleration limits and never moves backwards.
+ */
+static void runMotionProfile() {
+  const float moves[5][4] = {{0.50f, 0.3f, 1.0f, 5.0f},   // Cruise phase
+                             {0.05f, 0.3f, 1.0f, 5.0f},   // maxVel not reached
+                             {0.002f, 0.3f, 1.0f, 5.0f},  // maxAcc not reached
+                             {-1.20f, 0.6f, 2.0f, 20.0f}, // Negative
+                             {3.14f, 2.0f, 4.0f, 8.0f}};
+  MotionProfile move;
+  int m;
+
+  simExpect(!move.plan(1.0f, 0.0f, 1.0f, 1.0f), "MotionProfile rejects maxVel 0");
+  m = 0;
+  while (m < 5)
+  {
+    float d = moves[m][0], vMax = moves[m][1], aMax = moves[m][2];
+    bool ok = move.plan(d, vMax, aMax, moves[m][3]);
+    float dur = move.getDuration();
+    float p0, v0, a0, p1, v1, a1, pEnd, vEnd;
+    float worstV = 0.0f, worstA = 0.0f, back = 0.0f, last = 0.0f;
+    float t;
+
+    move.sample(0.0f, &p0, &v0, &a0);
+    move.sample(dur, &p1, &v1, &a1);
+    move.sample(dur - 1e-4f, &pEnd, &vEnd);
+    for (t = 0.0f; t < dur; t += 0.001f)
+    {
+      float p, v, a;
+      move.sample(t, &p, &v, &a);
+      if (fabsf(v) / vMax > worstV)
+        worstV = fabsf(v) / vMax;
+      if (fabsf(a) / aMax > worstA)
+        worstA = fabsf(a) / aMax;
+      float moved = (d >= 0.0f) ? p - last : last - p;
+      if (-moved > back)
+        back = -moved;
+      last = p;
+    }
+
+    printf("MotionProfile d %6.3f: %.3f s  start (%.3g, %.3g, %.3g)  end (%.4f, %.3g, %.3g)"
+           "  end - 0.1 ms pos err %.2g  peak |v| / max %.4f  |a| / max %.4f  backwards %.2g\n",
+           d, dur, p0, v0, a0, p1, v1, a1, fabsf(pEnd - d), worstV, worstA, back);
+    simExpect(ok && p0 == 0.0f && v0 == 0.0f && a0 == 0.0f, "MotionProfile starts at rest");
+    simExpect(p1 == d && v1 == 0.0f && a1 == 0.0f && move.isFinished(dur), "MotionProfile ends at rest on the distance");
+    simExpect(fabsf(pEnd - d) < 1e-3f * fabsf(d) + 1e-6f && fabsf(vEnd) < 1e-2f * vMax,
+              "MotionProfile end is continuous");
+    simExpect(worstV <= 1.001f && worstA <= 1.001f && back < 1e-6f, "MotionProfile within limits");
+    m++;
+  }
+}
+
+/**
+ * @brief DiffDrive velocity mode: wheel kinematics, ratio-preserving wheel
+ * speed cap, and the acceleration-limited path.
+ */
+static void runDiffDriveVelocity() {
+  const float r = 0.033f, track = 0.16f, dt = 0.02f;
+  DiffDrive drive(255);
+  bool ok;
+
+  // 1. No geometry: zero output
+  drive.computeVelocity(0.3f, 1.0f);
+  ok = drive.getLeftVelocity() == 0.0f && drive.getRightVelocity() == 0.0f;
+  simExpect(ok, "computeVelocity without geometry gives zero");
+
+  // 2. Kinematics: left = (v - w T / 2) / r, right = (v + w T / 2) / r
+  drive.setGeometry(r, track);
+  drive.computeVelocity(0.3f, 1.5f);
+  float wantL = (0.3f - 1.5f * track * 0.5f) / r, wantR = (0.3f + 1.5f * track * 0.5f) / r;
+  float err = fabsf(drive.getLeftVelocity() - wantL) + fabsf(drive.getRightVelocity() - wantR);
+  drive.computeVelocity(0.0f, -2.0f);
+  ok = drive.getLeftVelocity() > 0.0f && drive.getLeftVelocity() == -drive.getRightVelocity();
+
+  // 3. Cap: larger wheel at the cap, ratio unchanged
+  drive.setMaxWheelSpeed(10.0f);
+  drive.computeVelocity(0.3f, 1.5f);
+  float ratio = drive.getLeftVelocity() / drive.getRightVelocity();
+  float capErr = fabsf(drive.getRightVelocity() - 10.0f) + fabsf(ratio - wantL / wantR);
+  drive.setMaxWheelSpeed(0.0f);
+
+  // 4. Acceleration limits: v ramps at <= 0.5 m/s^2 and arrives exactly
+  drive.setAccelLimits(0.5f, 3.0f, 2.0f, 0.0f);
+  float lastV = 0.0f, worstStep = 0.0f;
+  int tick = 0;
+  while (tick < 200)
+  {
+    drive.computeVelocity(0.3f, 1.0f, dt);
+    float step = fabsf(drive.getLinear() - lastV);
+    if (step > worstStep)
+      worstStep = step;
+    lastV = drive.getLinear();
+    tick++;
+  }
+  float endErr = fabsf(drive.getLinear() - 0.3f) + fabsf(drive.getAngular() - 1.0f);
+  drive.stop();
+  bool stopped = drive.getLinear() == 0.0f && drive.getLeftVelocity() == 0.0f;
+
+  printf("DiffDrive velocity mode: kinematics err %.2g  cap err %.2g  worst |dv| / (a dt) %.4f"
+         "  end err %.2g  stop %s\n",
+         err, capErr, worstStep / (0.5f * dt), endErr, stopped ? "ok" : "FAIL");
+  simExpect(err < 1e-4f && ok, "computeVelocity wheel kinematics");
+  simExpect(capErr < 1e-4f, "computeVelocity cap keeps the wheel ratio");
+  simExpect(worstStep <= 0.5f * dt * 1.0001f && endErr == 0.0f, "computeVelocity respects and reaches the accel limits");
+  simExpect(stopped, "DiffDrive::stop zeroes the commands");
+}
+
+/**
+ * @brief Chassis: joystick -> DiffDrive mixer -> two wheel speed loops.
+ */
+static void runChassis(int joyX, int joyY, float seconds) {
+  DiffDriveChassis chassis;
+  BatteryPlant battery;
+  DiffDrive mixer((int)SIM_PWM_MAX);
+  FastPID leftPID(g_kp, g_ki, g_kd, 1);
+  FastPID rightPID(g_kp, g_ki, g_kd, 1);
+  CpuMeter cpu;
+  const float maxWheelSpeed = 200.0f; // rad/s commanded at full PWM
+  float pwmL = 0.0f, pwmR = 0.0f;
+  float peakCurrent = 0.0f, minVoltage = battery.voltage();
+  unsigned long steps = (unsigned long)(seconds * 1e6f / SIM_PLANT_DT_US);
+  unsigned long k;
+
+  hostSetMicros(0);
+  leftPID.setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+  rightPID.setSampleTime(SIM_CTRL_DT_US, PID_TIMEBASE_MICROS);
+
+  mixer.compute(joyX, joyY);
+  float targetL = mixer.getLeft() / SIM_PWM_MAX * maxWheelSpeed;
+  float targetR = mixer.getRight() / SIM_PWM_MAX * maxWheelSpeed;
+  StepMetrics metrics(0.0f, targetL);
+
+  std::chrono::steady_clock::time_point w0 = std::chrono::steady_clock::now();
+  k = 0;
+  while (k < steps)
+  {
+    if ((k * SIM_PLANT_DT_US) % SIM_CTRL_DT_US == 0)
+    {
+      unsigned long now = micros(); // One clock read for both controllers
+      cpu.start();
+      mixer.compute(joyX, joyY);
+      pwmL = leftPID.compute(targetL, chassis.left.speed(), now);
+      pwmR = rightPID.compute(targetR, chassis.right.speed(), now);
+      cpu.stop();
+    }
+
+    float dt = SIM_PLANT_DT_US * 1e-6f;
+    float vBus = battery.voltage();
+    chassis.step(pwmL / SIM_PWM_MAX * vBus, pwmR / SIM_PWM_MAX * vBus, dt);
+    battery.step(chassis.totalCurrent(), dt);
+    hostAdvanceMicros(SIM_PLANT_DT_US);
+
+    metrics.add(hostMicros() * 1e-6f, chassis.left.speed(), fabsf(pwmL) >= SIM_PWM_MAX);
+    if (chassis.totalCurrent() > peakCurrent)
+      peakCurrent = chassis.totalCurrent();
+    if (battery.voltage() < minVoltage)
+      minVoltage = battery.voltage();
+    k++;
+  }
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - w0).count();
+
+  char name[32];
+  snprintf(name, sizeof(name), "Chassis x=%d y=%d", joyX, joyY);
+  report(name, metrics, cpu, seconds, wall);
+  printf("%-22s v %.3f m/s  w %.3f rad/s  pose (%.2f, %.2f, %.2f rad)  peak %.2f A  min %.2f V\n",
+         "", chassis.linearSpeed(), chassis.angularSpeed(), chassis.x(), chassis.y(),
+         chassis.heading(), peakCurrent, minVoltage);
+  simExpect(metrics.settlingTime() >= 0.0f && metrics.settlingTime() < 0.5f, "chassis wheel settles within 0.5 s");
+}
+
+/**
+ * @brief Quadrature edge generator -> QuadEncoder ISRs.
+ * Edge rate sweeps from 0 up to maxRate and back (optionally reversing);
+ * every update() period the estimate is compared with the true rate.
+ */
+static void runEncoder(float maxRate, float seconds, bool reverse) {
+  const uint8_t pinA = 40, pinB = 41;
+  const unsigned long stepUs = 2;      // Generator resolution (<= 1 edge per step)
+  const unsigned long updateUs = 10000;
+  static const uint8_t GRAY[4] = {0, 2, 3, 1}; // AB sequence, A leads = forward
+  QuadEncoder enc(pinA, pinB, 1200.0);
+  unsigned long steps = (unsigned long)(seconds * 1e6f / stepUs);
+  int phase = 2; // Pull-ups idle both channels HIGH (AB = 11)
+  long truth = 0;
+  double position = 0.0; // Exact edge position (fractional)
+  double worstErr = 0.0, sumErr = 0.0;
+  unsigned long samples = 0, k;
+  CpuMeter cpu;
+
+  hostSetMicros(0);
+  enc.begin();
+
+  std::chrono::steady_clock::time_point w0 = std::chrono::steady_clock::now();
+  k = 1;
+  while (k <= steps)
+  {
+    // Triangle speed profile (edges/s), or a linear sweep through zero
+    double x = (double)k / (double)steps;
+    double rate = reverse ? maxRate * (1.0 - 2.0 * x) : maxRate * (1.0 - fabs(2.0 * x - 1.0));
+
+    hostSetMicros((uint64_t)k * stepUs);
+    position += rate * stepUs * 1e-6;
+    while ((double)truth + 1.0 <= position || (double)truth - 1.0 >= position)
+    {
+      int dir = ((double)truth < position) ? 1 : -1;
+      phase = (phase + dir) & 3;
+      truth += dir;
+      hostSetPin(pinA, GRAY[phase] >> 1);
+      hostSetPin(pinB, GRAY[phase] & 1);
+    }
+
+    if ((k * stepUs) % updateUs == 0)
+    {
+      cpu.start();
+      enc.update();
+      cpu.stop();
+      // Compare with the mean rate over the last update period (what any
+      // estimator can observe), skipping < ~10 edges per period
+      double xPrev = (double)(k * stepUs - updateUs / 2) / (seconds * 1e6);
+      double mean = reverse ? maxRate * (1.0 - 2.0 * xPrev) : maxRate * (1.0 - fabs(2.0 * xPrev - 1.0));
+      if (fabs(mean) * updateUs * 1e-6 >= 10.0)
+      {
+        double rel = fabs(enc.getVelocity() - mean) / fabs(mean);
+        sumErr += rel;
+        if (rel > worstErr)
+          worstErr = rel;
+        samples++;
+      }
+    }
+    k++;
+  }
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - w0).count();
+  enc.end();
+
+  printf("Encoder %-14s peak %.0f edges/s  count %s  speed err mean %.3f %%  worst %.3f %%"
+         "  update %.1f ns  x%.0f real time\n",
+         reverse ? "reversing" : "ramp", maxRate, (enc.getCount() == truth) ? "exact" : "LOST",
+         samples ? 100.0 * sumErr / samples : 0.0, 100.0 * worstErr, cpu.nsPerCall(),
+         wall > 0.0 ? seconds / wall : 0.0);
+  simExpect(enc.getCount() == truth, "encoder count matches every generated edge");
+  simExpect(samples > 0 && sumErr / samples < 0.01, "encoder mean speed error < 1 %");
+}
+
+/**
+ * @brief Fixed-point Odometry vs. a double reference fed the same ticks.
+ * The chassis drives a wandering path; wheel angles are quantized to
+ * encoder ticks, so the only difference left is the integer arithmetic.
+ */
+static void runOdometry(float seconds) {
+  const double radius = 0.033, track = 0.16, cpr = 1200.0;
+  const unsigned long updateUs = 1000;
+  DiffDriveChassis chassis(radius, track);
+  Odometry odom;
+  double rx = 0.0, ry = 0.0, rth = 0.0; // Reference pose
+  double path = 0.0;
+  long lastL = 0, lastR = 0;
+  double worstPos = 0.0, worstTh = 0.0;
+  unsigned long steps = (unsigned long)(seconds * 1e6f / SIM_PLANT_DT_US);
+  unsigned long k;
+  CpuMeter cpu;
+
+  odom.setGeometry(radius, track, cpr);
+  odom.update(0, 0);
+
+  k = 1;
+  while (k <= steps)
+  {
+    double t = k * SIM_PLANT_DT_US * 1e-6;
+    // Wandering path: steady forward voltage plus slow alternating turns
+    double turn = 3.0 * sin(t * 0.7) + 1.5 * sin(t * 2.3);
+    chassis.step((float)(6.0 - turn), (float)(6.0 + turn), SIM_PLANT_DT_US * 1e-6f);
+
+    if ((k * SIM_PLANT_DT_US) % updateUs == 0)
+    {
+      long ticksL = (long)floor(chassis.left.position() * cpr / (2.0 * M_PI));
+      long ticksR = (long)floor(chassis.right.position() * cpr / (2.0 * M_PI));
+
+      cpu.start();
+      odom.update(ticksL, ticksR);
+      cpu.stop();
+
+      double perTick = 2.0 * M_PI * radius / cpr;
+      double ds = 0.5 * (ticksL - lastL + ticksR - lastR) * perTick;
+      double dth = ((ticksR - lastR) - (ticksL - lastL)) * perTick / track;
+      rx += ds * cos(rth + 0.5 * dth);
+      ry += ds * sin(rth + 0.5 * dth);
+      rth += dth;
+      path += fabs(ds);
+      lastL = ticksL;
+      lastR = ticksR;
+
+      Pose p = odom.getPose();
+      double ePos = hypot(p.x - rx, p.y - ry);
+      double eTh = fabs(remainder(p.theta - rth, 2.0 * M_PI));
+      if (ePos > worstPos)
+        worstPos = ePos;
+      if (eTh > worstTh)
+        worstTh = eTh;
+    }
+    k++;
+  }
+
+  printf("Odometry %.0f s  path %.1f m  drift vs double: pos %.3f mm  heading %.4f mrad"
+         "  update %.1f ns\n",
+         seconds, path, worstPos * 1000.0,
+         worstTh * 1000.0, cpu.nsPerCall());
+  simExpect(worstPos < 0.001 && worstTh < 0.001, "odometry drift < 1 mm and < 1 mrad");
+}
+
+/**
+ * @brief TickClock on a virtual 32-bit microsecond source started just
+ * before its wrap, advanced by random tick lengths. The 64-bit counters
+ * must match an exact reference, and TaskManager::run(now) fed the
+ * snapshot must keep its period across the wrap.
+ */
+static uint32_t g_virtualUs = 0;
+
+static unsigned long virtualMicros() {
+  return g_virtualUs;
+}
+
+static unsigned long g_taskRuns = 0;
+
+static void countTask() {
+  g_taskRuns++;
+}
+
+static void runTickClock(unsigned long ticks) {
+  TaskManager tasks;
+  uint64_t reference;
+  unsigned long i, errors = 0, wraps = 0;
+
+  srand(3);
+  g_virtualUs = 0xFFFFFFFFUL - 3000000UL; // 3 s before the source wraps
+  TickClock::setSource(virtualMicros);
+  reference = g_virtualUs;
+  tasks.addTask(countTask, 10);
+  g_taskRuns = 0;
+
+  i = 0;
+  while (i < ticks)
+  {
+    uint32_t step = 1 + rand() % 3000;
+    uint32_t before = g_virtualUs;
+    g_virtualUs += step;
+    if (g_virtualUs < before)
+      wraps++;
+    reference += step;
+
+    TickClock::sample();
+    if (TickClock::us64() != reference || TickClock::ms64() != reference / 1000)
+      errors++;
+    tasks.run(TickClock::ms());
+    i++;
+  }
+
+  double seconds = (double)(reference - (0xFFFFFFFFUL - 3000000UL)) / 1e6;
+  printf("TickClock %lu ticks  %.1f s  source wraps %lu  counter errors %lu"
+         "  10 ms task runs %lu (at most %.0f)\n",
+         ticks, seconds, wraps, errors, g_taskRuns, seconds * 100.0);
+  simExpect(wraps > 0 && errors == 0, "TickClock 64-bit counters exact across the source wrap");
+  simExpect(g_taskRuns <= seconds * 100.0 && g_taskRuns >= seconds * 90.0,
+            "10 ms task keeps its period across the wrap");
+  TickClock::setSource(NULL);
+}
+
+/**
+ * @brief 10k timers on a TimerWheel for 120 s of virtual time: 9000
+ * one-shots (1 ms - 100 s), 1000 periodic (10 ms - 1 s), and every ms
+ * 5 watchdog restarts plus a cancel and a fresh start. Expected fires per
+ * ms are tracked in a histogram and compared with the actual ones.
+ * A linear scan over 10k deadlines is timed for comparison.
+ */
+#define SIM_TIMERS      10000
+#define SIM_TIMER_SPAN  120000 // ms
+
+static TimerWheel<SIM_TIMERS> g_wheel;
+static int32_t g_expected[SIM_TIMER_SPAN + 1];
+static int32_t g_fired[SIM_TIMER_SPAN + 1];
+static uint32_t g_wheelBase = 0;
+
+static void countFire() {
+  uint32_t t = millis() - g_wheelBase;
+  if (t <= SIM_TIMER_SPAN)
+    g_fired[t]++;
+}
+
+static void expectAt(uint32_t t, int32_t n) {
+  if (t <= SIM_TIMER_SPAN)
+    g_expected[t] += n;
+}
+
+static void runTimerWheel() {
+  static TimerHandle handles[SIM_TIMERS];
+  static uint32_t due[SIM_TIMERS];      // Expected expiry (one-shots)
+  static uint32_t deadline[SIM_TIMERS]; // For the linear-scan comparison
+  CpuMeter startCpu, opCpu, tickCpu, scanCpu;
+  unsigned long ops = 0, hits = 0;
+  int i;
+
+  srand(11);
+  hostSetMicros(5000000); // Arbitrary epoch
+  g_wheelBase = millis();
+  memset(g_expected, 0, sizeof(g_expected));
+  memset(g_fired, 0, sizeof(g_fired));
+  g_wheel.clear();
+  g_wheel.update(millis());
+
+  // 1. Arm 10k timers
+  startCpu.start();
+  i = 0;
+  while (i < SIM_TIMERS)
+  {
+    if (i < 9000)
+    {
+      uint32_t delay = 1 + rand() % 100000;
+      handles[i] = g_wheel.start(countFire, delay);
+      due[i] = delay;
+    }
+    else
+    {
+      uint32_t period = 10 + rand() % 991;
+      handles[i] = g_wheel.start(countFire, period, period);
+      due[i] = period;
+    }
+    i++;
+  }
+  startCpu.stop();
+  i = 0;
+  while (i < SIM_TIMERS)
+  {
+    if (i < 9000)
+      expectAt(due[i], 1);
+    else
+    {
+      uint32_t t = due[i];
+      while (t <= SIM_TIMER_SPAN)
+      {
+        expectAt(t, 1);
+        t += due[i];
+      }
+    }
+    deadline[i] = rand();
+    i++;
+  }
+
+  // 2. Run: per ms the batch update, then 5 restarts, 1 cancel + 1 start
+  uint32_t t = 0;
+  while (t < SIM_TIMER_SPAN)
+  {
+    hostAdvanceMicros(1000);
+    t++;
+
+    tickCpu.start();
+    g_wheel.update(millis());
+    tickCpu.stop();
+
+    opCpu.start();
+    int k = 0;
+    while (k < 7)
+    {
+      int j = rand() % 9000;
+      if (k < 5)
+      {
+        uint32_t delay = 50 + rand() % 500;
+        if (g_wheel.restart(handles[j], delay))
+        {
+          expectAt(due[j], -1);
+          due[j] = t + delay;
+          expectAt(due[j], 1);
+        }
+      }
+      else if (k == 5)
+      {
+        if (g_wheel.cancel(handles[j]))
+          expectAt(due[j], -1);
+      }
+      else if (!g_wheel.isActive(handles[j]))
+      {
+        uint32_t delay = 1 + rand() % 100000;
+        handles[j] = g_wheel.start(countFire, delay);
+        due[j] = t + delay;
+        expectAt(due[j], 1);
+      }
+      k++;
+    }
+    ops += 7;
+    opCpu.stop();
+
+    // Naive alternative: compare every deadline each tick
+    scanCpu.start();
+    i = 0;
+    while (i < SIM_TIMERS)
+    {
+      if ((int32_t)(t - deadline[i]) >= 0)
+      {
+        deadline[i] = t + 0x7FFFFFFF;
+        hits++;
+      }
+      i++;
+    }
+    scanCpu.stop();
+  }
+
+  // 3. Compare fire histogram with the expectation
+  unsigned long fired = 0, mismatched = 0;
+  t = 0;
+  while (t <= SIM_TIMER_SPAN)
+  {
+    fired += g_fired[t];
+    if (g_fired[t] != g_expected[t])
+      mismatched++;
+    t++;
+  }
+
+  printf("TimerWheel %d timers %d s: fired %lu  ms with wrong fire count %lu  active at end %u\n",
+         SIM_TIMERS, SIM_TIMER_SPAN / 1000, fired, mismatched, g_wheel.getActiveCount());
+  printf("  start %.1f ns  restart/cancel/start mix %.1f ns/op  update %.0f ns/ms"
+         "  |  linear scan of %d deadlines %.0f ns/ms%s\n",
+         startCpu.nsPerCall() / SIM_TIMERS, opCpu.nsPerCall() / 7, tickCpu.nsPerCall(),
+         SIM_TIMERS, scanCpu.nsPerCall(), hits ? "" : " ");
+  simExpect(mismatched == 0, "TimerWheel fires match the expected histogram");
+}
+
+/**
+ * @brief Call cost of a Callback in each of its forms against a raw
+ * function pointer. All targets do the same work (one counter increment)
+ * and are called from arrays so the compiler cannot resolve the target.
+ */
+#define SIM_CALLS 20000000UL
+
+static volatile unsigned long g_calls = 0;
+
+static void countCall() {
+  g_calls++;
+}
+
+struct SimCounter {
+  void tick() { g_calls++; }
+};
+
+static VoidFunction g_rawCalls[8];
+static Callback g_callbacks[8];
+
+static double timeCallbacks() {
+  CpuMeter cpu;
+  unsigned long i;
+  cpu.start();
+  i = 0;
+  while (i < SIM_CALLS)
+  {
+    g_callbacks[i & 7]();
+    i++;
+  }
+  cpu.stop();
+  return cpu.nsPerCall() / SIM_CALLS;
+}
+
+static void runCallbackCost() {
+  static SimCounter counters[8];
+  CpuMeter cpu;
+  unsigned long i;
+  int k;
+
+  // 1. Raw function pointer
+  k = 0;
+  while (k < 8)
+  {
+    g_rawCalls[k] = countCall;
+    k++;
+  }
+  cpu.start();
+  i = 0;
+  while (i < SIM_CALLS)
+  {
+    g_rawCalls[i & 7]();
+    i++;
+  }
+  cpu.stop();
+  double raw = cpu.nsPerCall() / SIM_CALLS;
+
+  // 2. The Callback forms
+  k = 0;
+  while (k < 8)
+  {
+    g_callbacks[k] = Callback::bind<SimCounter, &SimCounter::tick>(&counters[k]);
+    k++;
+  }
+  double bound = timeCallbacks();
+
+  k = 0;
+  while (k < 8)
+  {
+    g_callbacks[k] = Callback(&counters[k], &SimCounter::tick);
+    k++;
+  }
+  double member = timeCallbacks();
+
+  k = 0;
+  while (k < 8)
+  {
+    SimCounter* c = &counters[k];
+    g_callbacks[k] = [c]() { c->tick(); };
+    k++;
+  }
+  double lambda = timeCallbacks();
+
+  k = 0;
+  while (k < 8)
+  {
+    g_callbacks[k] = countCall;
+    k++;
+  }
+  double function = timeCallbacks();
+
+  printf("Callback call cost (ns): raw pointer %.2f  bind<> %.2f  member %.2f  lambda %.2f"
+         "  function %.2f  (size %u bytes, %lu calls)\n",
+         raw, bound, member, lambda, function, (unsigned)sizeof(Callback), g_calls);
+  simExpect(sizeof(Callback) == (CALLBACK_WORDS + 1) * sizeof(void*),
+            "Callback is its buffer plus one stub pointer");
+}
+
+/**
+ * @brief WindowStats against a brute-force recomputation of the window on
+ * every sample: a slow sine sweep across [lo, hi] plus 10 % uniform noise.
+ * Min / max must match exactly; mean, variance and slope within a small
+ * fraction of the span (the results are float).
+ */
+template <class T, int N>
+static void runWindowStats(const char* name, double lo, double hi, unsigned long samples) {
+  WindowStats<T, N> stats;
+  T window[N];
+  double span = hi - lo;
+  double worstMean = 0.0, worstVar = 0.0, worstSlope = 0.0;
+  unsigned long k, wrong = 0;
+
+  srand(17);
+  k = 0;
+  while (k < samples)
+  {
+    double noise = span * 0.1 * (rand() / (double)RAND_MAX - 0.5);
+    double v = lo + span * (0.5 + 0.45 * sin(k * 0.013)) + noise;
+    if (v < lo)
+      v = lo;
+    if (v > hi)
+      v = hi;
+    T value = (T)v;
+    stats.push(value);
+    window[k % N] = value;
+    k++;
+
+    // Reference over the window, oldest first
+    int n = (k < (unsigned long)N) ? (int)k : N;
+    int i;
+    T mn = window[(k - n) % N], mx = mn;
+    double sum = 0.0, sumSq = 0.0, sumI = 0.0, sumIy = 0.0, sumI2 = 0.0;
+    for (i = 0; i < n; i++)
+    {
+      T y = window[(k - n + i) % N];
+      if (y < mn)
+        mn = y;
+      if (y > mx)
+        mx = y;
+      sum += (double)y;
+      sumI += i;
+      sumI2 += (double)i * i;
+      sumIy += (double)i * (double)y;
+    }
+    double mean = sum / n;
+    for (i = 0; i < n; i++)
+    {
+      double d = (double)window[(k - n + i) % N] - mean;
+      sumSq += d * d;
+    }
+    double variance = sumSq / n;
+    double slope = (n > 1) ? (n * sumIy - sumI * sum) / (n * sumI2 - sumI * sumI) : 0.0;
+
+    double eMean = fabs(stats.mean() - mean) / span;
+    double eVar = fabs(stats.variance() - variance) / (span * span);
+    double eSlope = fabs(stats.slope() - slope) / span;
+    if (stats.min() != mn || stats.max() != mx || stats.count() != n ||
+        eMean > 1e-5 || eVar > 1e-5 || eSlope > 1e-5)
+      wrong++;
+    if (eMean > worstMean)
+      worstMean = eMean;
+    if (eVar > worstVar)
+      worstVar = eVar;
+    if (eSlope > worstSlope)
+      worstSlope = eSlope;
+  }
+
+  printf("WindowStats %-22s N %2d  %lu samples: wrong %lu  worst error / span: mean %.1e"
+         "  variance %.1e  slope %.1e\n",
+         name, N, samples, wrong, worstMean, worstVar, worstSlope);
+  simExpect(wrong == 0, "WindowStats matches the brute-force window");
+}
+
+int main(int argc, char** argv) {
+  if (argc == 4)
+  {
+    g_kp = (float)atof(argv[1]);
+    g_ki = (float)atof(argv[2]);
+    g_kd = (float)atof(argv[3]);
+  }
+  printf("RobotisTools host simulation  (Kp %.3f  Ki %.4f  Kd %.3f, 1 kHz loop)\n", g_kp, g_ki, g_kd);
+
+  FastPID floatPID(g_kp, g_ki, g_kd, 1);
+  runMotorStep("Motor step FastPID", floatPID, 150.0f, 2.0f);
+
+  FixedPID fixedPID(g_kp, g_ki, g_kd, 1);
+  runMotorStep("Motor step FixedPID", fixedPID, 150.0f, 2.0f);
+  runFixedPointOps();
+  runLateSample();
+  runFixedVsFloat(0, 4.0f);
+  runFixedVsFloat(2000, 4.0f);
+  runMultiPID();
+
+  runMixer(255);
+  runMixer(1023);
+  runSlewLimiter(0.0f);
+  runSlewLimiter(3.0f);
+  runSlewLimiter(50.0f);
+  runMotionProfile();
+  runDiffDriveVelocity();
+  runChassis(0, 80, 3.0f);
+  runChassis(40, 60, 3.0f);
+
+  runEncoder(200000.0f, 2.0f, false);
+  runEncoder(20000.0f, 2.0f, true);
+
+  runOdometry(120.0f);
+
+  runTickClock(20000);
+  runTimerWheel();
+  runCallbackCost();
+
+  runWindowStats<int, 32>("int, 10-bit ADC", 0.0, 1023.0, 200000);
+  runWindowStats<int16_t, 32>("int16_t, full range", -32768.0, 32767.0, 200000);
+  runWindowStats<uint8_t, 64>("uint8_t, full range", 0.0, 255.0, 200000);
+  runWindowStats<int32_t, 16>("int32_t, +-1e6", -1e6, 1e6, 200000);
+  runWindowStats<float, 8>("float, 1e4 +- 50", 1e4 - 50.0, 1e4 + 50.0, 200000);
+  return simExitCode();
+}
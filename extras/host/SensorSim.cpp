@@ -0,0 +1,846 @@
+/**
+ * @file SensorSim.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Host Simulation of the Sensor Drivers.
+ * Simulated HC-SR04s answer the real AsyncSonar / SonarArray trigger pulses
+ * with echo edges on the virtual clock; the ping schedule is logged and
+ * checked for crosstalk and rest-interval violations. Analog drivers run
+ * against a noisy simulated ADC whose analogRead() costs virtual time.
+ *
+ * Usage: sensor_sim
+ * @version 1.2.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <Arduino.h>
+#include "RobotisTools.h"
+#include "SimMetrics.h"
+
+#include <chrono>
+#include <string.h>
+#include <vector>
+
+#define SIM_STEP_US 5
+
+/**
+ * @brief One simulated HC-SR04: watches its Trig pin and drives Echo.
+ * Echo rises ~450 us after the trigger and stays high for the round trip
+ * at the true air temperature. A fraction of pings return a spurious
+ * short echo (e.g. a cable or floor reflection).
+ */
+struct SimSonar {
+  uint8_t trig, echo;
+  float distanceCm;
+  int lastTrig;
+  uint64_t riseAt, fallAt; // 0 = nothing scheduled
+
+  void schedule(uint64_t now, float airC, bool spurious) {
+    float cmPerUs = (331.3f + 0.606f * airC) / 10000.0f;
+    float d = spurious ? distanceCm * 0.3f : distanceCm;
+    riseAt = now + 450;
+    fallAt = riseAt + (uint64_t)(2.0f * d / cmPerUs);
+  }
+
+  /**
+   * @return true on a trigger falling edge (start of a ping).
+   */
+  bool step(uint64_t now, float airC, bool spurious) {
+    bool pinged = false;
+    int t = hostGetPin(trig);
+    if (lastTrig == HIGH && t == LOW)
+    {
+      schedule(now, airC, spurious);
+      pinged = true;
+    }
+    lastTrig = t;
+    if (riseAt && now >= riseAt)
+    {
+      hostSetPin(echo, HIGH);
+      riseAt = 0;
+    }
+    if (fallAt && now >= fallAt && !riseAt)
+    {
+      hostSetPin(echo, LOW);
+      fallAt = 0;
+    }
+    return pinged;
+  }
+};
+
+struct Ping {
+  int sensor;
+  uint64_t start; // Trigger
+  uint64_t end;   // Echo fall (end of listening)
+};
+
+/**
+ * @brief SonarArray schedule, median filter and temperature compensation.
+ */
+static void runSonarArray(int count, int groupsOf, float airC, bool compensate, float seconds) {
+  std::vector<AsyncSonar*> sonars;
+  std::vector<SimSonar> sims;
+  std::vector<Ping> pings;
+  std::vector<int> groupOf;
+  SonarArray array;
+  int i;
+
+  srand(7);
+  hostSetMicros(0);
+  for (i = 0; i < count; i++)
+  {
+    SimSonar s = {(uint8_t)(60 + 2 * i), (uint8_t)(61 + 2 * i), 40.0f + 25.0f * i, LOW, 0, 0};
+    sims.push_back(s);
+    sonars.push_back(new AsyncSonar(s.trig, s.echo));
+    groupOf.push_back(i / groupsOf);
+    array.add(*sonars.back(), i / groupsOf);
+  }
+  array.setMedian(5);
+  array.setRestInterval(60000);
+  if (compensate)
+    array.setTemperature(airC);
+  array.begin();
+
+  uint64_t end = (uint64_t)(seconds * 1e6f);
+  uint64_t now = 0;
+  double rawErr = 0.0, filtErr = 0.0;
+  unsigned long samples = 0, lastCycle = 0;
+  std::vector<int> open(count, -1);
+
+  while (now < end)
+  {
+    now += SIM_STEP_US;
+    hostSetMicros(now);
+    for (i = 0; i < count; i++)
+    {
+      bool spurious = (rand() % 10) == 0;
+      if (sims[i].step(now, airC, spurious))
+      {
+        Ping p = {i, now, 0};
+        open[i] = (int)pings.size();
+        pings.push_back(p);
+      }
+      if (open[i] >= 0 && !sims[i].riseAt && !sims[i].fallAt)
+      {
+        pings[open[i]].end = now;
+        open[i] = -1;
+      }
+    }
+    array.update();
+
+    float ranges[SONAR_ARRAY_MAX];
+    unsigned long cycle = array.getSnapshot(ranges, SONAR_ARRAY_MAX);
+    if (cycle != lastCycle && cycle > 5)
+    {
+      for (i = 0; i < count; i++)
+      {
+        rawErr += fabs(sonars[i]->getDistance() - sims[i].distanceCm);
+        filtErr += fabs(ranges[i] - sims[i].distanceCm);
+        samples++;
+      }
+    }
+    lastCycle = cycle;
+  }
+
+  // Schedule checks: different groups never in flight together; rest interval
+  int overlaps = 0, restViolations = 0;
+  size_t a, b;
+  for (a = 0; a < pings.size(); a++)
+  {
+    if (pings[a].end == 0)
+      continue;
+    for (b = a + 1; b < pings.size() && pings[b].start < pings[a].end; b++)
+      if (groupOf[pings[a].sensor] != groupOf[pings[b].sensor])
+        overlaps++;
+    for (b = a + 1; b < pings.size(); b++)
+      if (pings[b].sensor == pings[a].sensor)
+      {
+        if (pings[b].start - pings[a].start < 60000)
+          restViolations++;
+        break;
+      }
+  }
+
+  printf("Sonar %d sensors, groups of %d, %4.1f C %-12s %5.1f pings/s  cycles %lu"
+         "  crosstalk overlaps %d  rest violations %d  err raw %.2f cm  median %.2f cm\n",
+         count, groupsOf, airC, compensate ? "compensated" : "(20 C const)",
+         pings.size() / seconds, array.getCycleCount(), overlaps, restViolations,
+         samples ? rawErr / samples : 0.0, samples ? filtErr / samples : 0.0);
+  simExpect(overlaps == 0 && restViolations == 0, "sonar schedule: no crosstalk, rest interval kept");
+  if (compensate)
+    simExpect(samples > 0 && filtErr / samples < 1.0, "compensated median range error < 1 cm");
+
+  for (i = 0; i < count; i++)
+  {
+    sonars[i]->end();
+    delete sonars[i];
+  }
+}
+
+/**
+ * @brief Noisy ADC input around a slowly moving level.
+ */
+static int noisyAdc(float level, int noise) {
+  int v = (int)level + (rand() % (2 * noise + 1)) - noise;
+  return v < 0 ? 0 : (v > 1023 ? 1023 : v);
+}
+
+/**
+ * @brief SmartAnalog + BatteryMonitor queried every loop, polled on demand
+ * vs. attached to an AnalogSampler. Reports the time spent in getters,
+ * the conversions they caused and the per-channel sample rates.
+ */
+static void runAnalogSampler(bool attached, unsigned long adcCostUs, float seconds) {
+  SmartAnalog ldr(A0, 10);
+  SmartAnalog pot(A0 + 1, 4);
+  BatteryMonitor battery(A0 + 2, 3.0f, 5.0f);
+  AnalogSampler adc;
+
+  srand(11);
+  hostSetMicros(0);
+  hostSetAnalogCost(adcCostUs);
+  hostSetAnalog(A0 + 2, (int)(7.4f / 3.0f / 5.0f * 1023.0f));
+  ldr.begin();
+  pot.begin();
+  battery.begin(6.0f, 8.4f);
+  ldr.setThreshold(600, 20);
+  if (attached)
+  {
+    ldr.attach(adc);
+    pot.attach(adc);
+    battery.attach(adc);
+    adc.setInterval(250);
+    adc.begin();
+  }
+
+  uint64_t end = (uint64_t)(seconds * 1e6f);
+  uint64_t getterUs = 0;
+  unsigned long loops = 0, toggles = 0;
+  unsigned long readsBefore = hostAnalogReads(), getterReads = 0;
+  bool lastActive = false;
+  float err = 0.0f;
+
+  while (hostMicros() < end)
+  {
+    float t = hostMicros() * 1e-6f;
+    hostSetAnalog(A0, noisyAdc(600.0f + 200.0f * sinf(t), 25));
+    hostSetAnalog(A0 + 1, noisyAdc(300.0f, 8));
+    hostSetAnalog(A0 + 2, noisyAdc(7.4f / 3.0f / 5.0f * 1023.0f, 6));
+
+    if (attached)
+      adc.update();
+    battery.update();
+
+    // Application code: query everything every loop
+    uint64_t t0 = hostMicros();
+    unsigned long r0 = hostAnalogReads();
+    bool active = ldr.isActive();
+    int pct = pot.readPercentage();
+    float volts = battery.getVoltage();
+    bool low = battery.isLow();
+    getterUs += hostMicros() - t0;
+    getterReads += hostAnalogReads() - r0;
+    (void)pct;
+    (void)low;
+
+    if (active != lastActive)
+      toggles++;
+    lastActive = active;
+    if (t > 0.5f)
+      err += fabsf(volts - 7.4f);
+    loops++;
+    hostAdvanceMicros(20); // Rest of loop()
+  }
+
+  printf("Analog %-9s adc %3lu us  loops %7lu  getter time %5.1f %%  conversions/loop %.2f"
+         "  (by getters %lu)  battery err %.3f V  ldr toggles %lu\n",
+         attached ? "sampler" : "on-demand", adcCostUs, loops,
+         100.0 * getterUs / (double)end, (hostAnalogReads() - readsBefore) / (double)loops,
+         getterReads, loops ? err / loops : 0.0f, toggles);
+  simExpect(loops > 0 && err / loops < 0.05f, "battery voltage error < 50 mV");
+  if (attached)
+    simExpect(getterReads == 0, "attached getters do not convert");
+  if (attached)
+  {
+    int ch;
+    for (ch = 0; ch < adc.getCount(); ch++)
+      printf("  channel %d: %.1f samples/s (%lu total)\n", ch, adc.getSampleRate(ch),
+             adc.getSampleCount(ch));
+  }
+  hostSetAnalogCost(0);
+}
+
+/**
+ * @brief Resting 3S LiPo voltage at a state of charge (0..1).
+ */
+static float lipoRestVoltage(float soc) {
+  static const float curve[11] = {3.27f, 3.69f, 3.75f, 3.79f, 3.83f, 3.87f,
+                                  3.92f, 3.97f, 4.03f, 4.11f, 4.20f};
+  float x = soc * 10.0f;
+  int i = (int)x;
+  if (i >= 10)
+    return 3.0f * curve[10];
+  if (i < 0)
+    return 3.0f * curve[0];
+  return 3.0f * (curve[i] + (curve[i + 1] - curve[i]) * (x - i));
+}
+
+/**
+ * @brief 3S LiPo discharging under bursty motor load, read by three
+ * BatteryMonitors on the same divider: linear map, LiPo curve, and LiPo
+ * curve with load compensation. A fourth monitor is queried 100 times
+ * per loop to show the result does not depend on the query rate.
+ */
+static void runBatteryMonitor(float seconds) {
+  const float rInternal = 0.15f;
+  const float capacity = 340.0f; // Coulomb (~0.094 Ah, drains in ~2 min)
+  const uint8_t pin = A0 + 3;
+  BatteryMonitor linear(pin, 3.0f, 5.0f);
+  BatteryMonitor curve(pin, 3.0f, 5.0f);
+  BatteryMonitor compensated(pin, 3.0f, 5.0f);
+  BatteryMonitor busy(pin, 3.0f, 5.0f);
+  float soc = 1.0f, current = 0.4f;
+
+  hostSetMicros(0);
+  hostSetAnalog(pin, (int)(lipoRestVoltage(soc) / 3.0f / 5.0f * 1023.0f));
+  linear.begin(9.9f, 12.6f);
+  curve.begin(9.9f, 12.6f);
+  compensated.begin(9.9f, 12.6f);
+  busy.begin(9.9f, 12.6f);
+  curve.setChemistry(BATTERY_LIPO, 3);
+  compensated.setChemistry(BATTERY_LIPO, 3);
+  compensated.setInternalResistance(rInternal);
+
+  double err[3] = {0, 0, 0};
+  int worst[3] = {0, 0, 0};
+  unsigned long falseLow[3] = {0, 0, 0};
+  unsigned long n = 0, mismatches = 0, getterReads = 0;
+  uint64_t end = (uint64_t)(seconds * 1e6f);
+
+  while (hostMicros() < end && soc > 0.02f)
+  {
+    // 1. Plant: 0.4 A idle, 8 A motor bursts (300 ms of every second)
+    current = ((hostMicros() / 1000) % 1000 < 300) ? 8.0f : 0.4f;
+    soc -= current * 0.001f / capacity;
+    float terminal = lipoRestVoltage(soc) - current * rInternal;
+    hostSetAnalog(pin, (int)(terminal / 3.0f / 5.0f * 1023.0f + 0.5f));
+
+    // 2. Monitors
+    compensated.setLoadCurrent(current);
+    linear.update();
+    curve.update();
+    compensated.update();
+    busy.update();
+
+    unsigned long r0 = hostAnalogReads();
+    int k;
+    for (k = 0; k < 100; k++)
+      busy.isLow();
+    getterReads += hostAnalogReads() - r0;
+    if (busy.getVoltage() != linear.getVoltage())
+      mismatches++;
+
+    // 3. Score against the true state of charge (after the filter settles)
+    if (hostMicros() > 3000000)
+    {
+      int truth = (int)(soc * 100.0f + 0.5f);
+      int pct[3] = {linear.getPercentage(), curve.getPercentage(), compensated.getPercentage()};
+      bool low[3] = {linear.isLow(), curve.isLow(), compensated.isLow()};
+      for (k = 0; k < 3; k++)
+      {
+        int e = abs(pct[k] - truth);
+        err[k] += e;
+        if (e > worst[k])
+          worst[k] = e;
+        if (low[k] && truth > BATTERY_LOW_PERCENT + 5)
+          falseLow[k]++;
+      }
+      n++;
+    }
+    hostAdvanceMicros(1000);
+  }
+
+  const char* names[3] = {"linear", "LiPo curve", "LiPo curve + I*R"};
+  int k;
+  printf("Battery 3S LiPo, 8 A bursts, R %.2f Ohm: %.1f s simulated, 100 queries/loop"
+         " -> ADC reads by getters %lu, results differing from a 1 query/loop monitor %lu\n",
+         rInternal, hostMicros() * 1e-6, getterReads, mismatches);
+  for (k = 0; k < 3; k++)
+    printf("  %-17s mean err %5.1f %%  worst %3d %%  false isLow() %5.1f s\n", names[k],
+           n ? err[k] / n : 0.0, worst[k], falseLow[k] * 0.001);
+  simExpect(getterReads == 0 && mismatches == 0, "battery result independent of the query rate");
+  simExpect(n > 0 && err[2] / n < 2.0 && falseLow[2] == 0, "compensated LiPo curve within 2 %, no false isLow()");
+}
+
+static float g_trueLsb = 0.0f; // Input in 10-bit LSBs
+
+/**
+ * @brief 10-bit ADC with triangular +-1 LSB noise ahead of the quantizer.
+ */
+static int ditheredAdc(uint8_t pin) {
+  (void)pin;
+  float d = (rand() / (float)RAND_MAX - 0.5f) + (rand() / (float)RAND_MAX - 0.5f);
+  int code = (int)floorf(g_trueLsb + d + 0.5f);
+  return code < 0 ? 0 : (code > 1023 ? 1023 : code);
+}
+
+/**
+ * @brief Oversampling sweep: the input steps across one 10-bit LSB in
+ * 1/64 LSB steps; every decimated result is compared with the input.
+ */
+static void runOversampling() {
+  printf("Oversampling, 10-bit ADC with +-1 LSB triangular dither (input swept over 1 LSB):\n");
+  srand(5);
+  hostSetAnalogHook(ditheredAdc);
+
+  uint8_t bits;
+  double rms0 = 0.0;
+  for (bits = 0; bits <= ANALOG_MAX_OVERSAMPLE; bits++)
+  {
+    AnalogSampler adc;
+    int ch = adc.addChannel(A0 + 4);
+    adc.setOversampling(ch, bits);
+    adc.begin();
+
+    double sq = 0.0;
+    unsigned long n = 0;
+    int step;
+    uint64_t t0 = hostMicros();
+    unsigned long conv0 = hostAnalogReads();
+    for (step = 0; step < 64; step++)
+    {
+      g_trueLsb = 512.0f + step / 64.0f;
+      unsigned long target = adc.getSampleCount(ch) + 4;
+      unsigned long skip = adc.getSampleCount(ch) + 1; // Result straddling the step
+      while (adc.getSampleCount(ch) < target)
+      {
+        adc.update();
+        hostAdvanceMicros(100);
+        if (adc.getSampleCount(ch) > skip)
+        {
+          double e = adc.getRaw(ch) / (double)(1 << bits) - g_trueLsb;
+          sq += e * e;
+          n++;
+          skip = adc.getSampleCount(ch);
+        }
+      }
+    }
+    double rms = sqrt(sq / n);
+    if (bits == 0)
+      rms0 = rms;
+    double convPerSec = (hostAnalogReads() - conv0) / ((hostMicros() - t0) * 1e-6);
+    printf("  +%u bits (%2u-bit, %4lu samples/result): rms error %.4f LSB10  gain %.2f bits"
+           "  result rate %.1f/s of %.0f conv/s\n",
+           bits, adc.getResolution(ch), 1UL << (2 * bits), rms, log2(rms0 / rms),
+           adc.getSampleCount(ch) / ((hostMicros() - t0) * 1e-6), convPerSec);
+    simExpect(log2(rms0 / rms) >= bits - 0.5, "oversampling gains within 0.5 bit of the added bits");
+  }
+  hostSetAnalogHook(NULL);
+}
+
+/**
+ * @brief An attached SmartAnalog switched to +2 bits must trip at the
+ * same input as before: threshold 500 +- 40 on the 10-bit scale, inputs
+ * 400 and 600 each held for 50 ms.
+ */
+static void runOversampledThreshold() {
+  const uint8_t pin = A0 + 9;
+  SmartAnalog sensor(pin, 10);
+  AnalogSampler adc;
+
+  hostSetAnalog(pin, 400);
+  sensor.begin();
+  sensor.setThreshold(500, 40);
+  sensor.attach(adc);
+  adc.setInterval(50);
+  adc.begin();
+  sensor.setOversampling(2);
+
+  bool ok = true;
+  int round;
+  for (round = 0; round < 4; round++)
+  {
+    int input = (round % 2) ? 600 : 400;
+    hostSetAnalog(pin, input);
+    uint64_t end = hostMicros() + 50000;
+    while (hostMicros() < end)
+    {
+      adc.update();
+      hostAdvanceMicros(10);
+    }
+    bool want = (input > 500);
+    printf("Oversampled threshold: input %d (x4 = %d)  active %d (want %d)\n",
+           input, input * 4, sensor.isActive(), want);
+    ok = ok && (sensor.isActive() == want);
+  }
+  simExpect(ok, "oversampled SmartAnalog keeps its trigger voltage");
+}
+
+static uint64_t g_edgeAt = 0;     // Time of the latest input step
+static double g_latencySum = 0.0, g_stampSum = 0.0;
+static unsigned long g_latencyMax = 0, g_events = 0;
+static int g_watchId = -1;
+
+static void onAnalogEvent(const AnalogEvent& e) {
+  if (e.watcher != g_watchId)
+    return;
+  unsigned long latency = (unsigned long)(hostMicros() - g_edgeAt);
+  g_latencySum += latency;
+  g_stampSum += (double)(uint32_t)(e.time - (uint32_t)g_edgeAt);
+  if (latency > g_latencyMax)
+    g_latencyMax = latency;
+  g_events++;
+}
+
+/**
+ * @brief Line-edge reaction time: the input steps between 200 and 800
+ * (+-10 noise) at random moments; latency is measured from the step to
+ * the code that reacts. Modes: isActive() polled by a 10 ms task
+ * (on-demand reads), a raw threshold watcher, and an attached
+ * SmartAnalog (watcher on the filtered value). 4 channels are scanned
+ * with a 50 us interval.
+ */
+static void runThresholdLatency(int mode, int edges) {
+  const char* names[3] = {"isActive() polled / 10 ms", "raw threshold watcher",
+                          "SmartAnalog attached (filtered)"};
+  const uint8_t pin = A0 + 5;
+  SmartAnalog line(pin, 10);
+  AnalogSampler adc;
+  bool level = false, lastActive = false;
+
+  srand(21);
+  hostSetMicros(0);
+  hostSetAnalog(pin, 200);
+  line.begin();
+  line.setThreshold(500, 40);
+  g_latencySum = g_stampSum = 0.0;
+  g_latencyMax = g_events = 0;
+  g_watchId = -1;
+
+  if (mode > 0)
+  {
+    int ch;
+    if (mode == 1)
+    {
+      ch = adc.addChannel(pin);
+      g_watchId = adc.addThreshold(ch, 500, 40);
+    }
+    else
+    {
+      line.attach(adc);
+      g_watchId = line.getWatcher();
+    }
+    adc.addChannel(A0 + 6);
+    adc.addChannel(A0 + 7);
+    adc.addChannel(A0 + 8);
+    adc.setInterval(50);
+    adc.setEventHandler(onAnalogEvent);
+    adc.begin();
+  }
+
+  uint64_t nextEdge = 20000 + rand() % 60000;
+  uint64_t nextPoll = 0;
+  int done = 0;
+  while (done < edges || hostMicros() < g_edgeAt + 100000)
+  {
+    uint64_t now = hostMicros();
+    if (now >= nextEdge && done < edges)
+    {
+      level = !level;
+      g_edgeAt = now;
+      nextEdge = now + 20000 + rand() % 60000;
+      done++;
+    }
+    hostSetAnalog(pin, noisyAdc(level ? 800.0f : 200.0f, 10));
+
+    if (mode > 0)
+      adc.update();
+    else if (now >= nextPoll)
+    {
+      nextPoll += 10000;
+      bool active = line.isActive();
+      if (active != lastActive)
+      {
+        AnalogEvent e = {0, 0, 0, 0, (unsigned long)now};
+        g_watchId = 0;
+        onAnalogEvent(e);
+      }
+      lastActive = active;
+    }
+    hostAdvanceMicros(10);
+  }
+
+  printf("Threshold %-32s edges %3d  detected %3lu  latency mean %7.1f us  max %6lu us",
+         names[mode], edges, g_events, g_events ? g_latencySum / g_events : 0.0, g_latencyMax);
+  if (mode > 0)
+    printf("  stamped %6.1f us after edge  dropped %lu", g_events ? g_stampSum / g_events : 0.0,
+           adc.getDroppedEvents());
+  printf("\n");
+  if (mode > 0)
+    simExpect(g_events == (unsigned long)edges && adc.getDroppedEvents() == 0,
+              "threshold watcher reports every edge");
+}
+
+/**
+ * @brief Scripted button presses with contact bounce.
+ * Each edge chatters for up to 6 ms before settling. Button i runs, every
+ * round, a short click (i % 3 == 0), an 1.2 s long press (1) or a double
+ * click (2). ButtonGroup events are checked against the script; 16
+ * Button objects on the same pins count isPressed() edges for comparison.
+ */
+#define SIM_BUTTONS 16
+
+static unsigned long g_btnEvents[SIM_BUTTONS][4];
+
+static void onButtonEvent(uint8_t button, uint8_t event) {
+  if (button < SIM_BUTTONS && event < 4)
+    g_btnEvents[button][event]++;
+}
+
+struct SimContact {
+  uint8_t pin;
+  bool level;           // Settled level (true = pressed)
+  uint64_t bounceUntil;
+
+  void set(uint64_t now, bool pressed) {
+    level = pressed;
+    bounceUntil = now + 1000 + rand() % 5000;
+  }
+
+  void step(uint64_t now) {
+    bool out = level;
+    if (now < bounceUntil)
+      out = rand() & 1;
+    hostSetPin(pin, out ? HIGH : LOW);
+  }
+};
+
+static void runButtonGroup(int rounds) {
+  ButtonGroup group;
+  Button* single[SIM_BUTTONS];
+  SimContact contact[SIM_BUTTONS];
+  unsigned long singlePresses = 0;
+  int i;
+
+  srand(5);
+  hostSetMicros(0);
+  memset(g_btnEvents, 0, sizeof(g_btnEvents));
+  i = 0;
+  while (i < SIM_BUTTONS)
+  {
+    contact[i].pin = 20 + i;
+    contact[i].level = false;
+    contact[i].bounceUntil = 0;
+    contact[i].step(0);
+    group.add(contact[i].pin, false); // Active-high, like Button
+    single[i] = new Button(contact[i].pin);
+    single[i]->begin();
+    i++;
+  }
+  group.setHandler(onButtonEvent);
+  group.begin();
+
+  // Script per round (ms from round start): press at 100 + 7 * i
+  // short: release +120 | long: release +1200 | double: +80, +230, +310
+  const uint64_t roundUs = 2500000;
+  uint64_t end = (uint64_t)rounds * roundUs + 500000;
+  double scanNs = 0.0, singleNs = 0.0;
+  unsigned long scans = 0;
+  while (hostMicros() < end)
+  {
+    uint64_t now = hostMicros();
+    uint64_t t = now % roundUs;
+    i = 0;
+    while (i < SIM_BUTTONS && now < (uint64_t)rounds * roundUs)
+    {
+      uint64_t at = 100000 + 7000 * i;
+      int kind = i % 3;
+      if (t == at)
+        contact[i].set(now, true);
+      if ((kind == 0 && t == at + 120000) || (kind == 1 && t == at + 1200000) ||
+          (kind == 2 && (t == at + 80000 || t == at + 310000)))
+        contact[i].set(now, false);
+      if (kind == 2 && t == at + 230000)
+        contact[i].set(now, true);
+      i++;
+    }
+    i = 0;
+    while (i < SIM_BUTTONS)
+    {
+      contact[i].step(now);
+      i++;
+    }
+
+    if (now % 5000 == 0)
+    {
+      std::chrono::steady_clock::time_point a = std::chrono::steady_clock::now();
+      group.scan();
+      std::chrono::steady_clock::time_point b = std::chrono::steady_clock::now();
+      i = 0;
+      while (i < SIM_BUTTONS)
+      {
+        if (single[i]->isPressed())
+          singlePresses++;
+        i++;
+      }
+      std::chrono::steady_clock::time_point c = std::chrono::steady_clock::now();
+      scanNs += std::chrono::duration<double, std::nano>(b - a).count();
+      singleNs += std::chrono::duration<double, std::nano>(c - b).count();
+      scans++;
+    }
+    hostAdvanceMicros(100);
+  }
+
+  // Expected per round: short 1P 1R | long 1P 1R 1L | double 2P 2R 1D
+  int wrong = 0;
+  unsigned long total[4] = {0, 0, 0, 0};
+  unsigned long expectedPresses = 0;
+  i = 0;
+  while (i < SIM_BUTTONS)
+  {
+    int kind = i % 3;
+    unsigned long p = (kind == 2) ? 2 : 1;
+    unsigned long want[4] = {p * rounds, p * rounds, (kind == 1) ? (unsigned long)rounds : 0,
+                             (kind == 2) ? (unsigned long)rounds : 0};
+    int e = 0;
+    while (e < 4)
+    {
+      if (g_btnEvents[i][e] != want[e])
+        wrong++;
+      total[e] += g_btnEvents[i][e];
+      e++;
+    }
+    expectedPresses += want[0];
+    delete single[i];
+    i++;
+  }
+
+  printf("ButtonGroup %d buttons x %d rounds: press %lu release %lu long %lu double %lu"
+         "  (expected press %lu, %d counters wrong)\n",
+         SIM_BUTTONS, rounds, total[0], total[1], total[2], total[3], expectedPresses, wrong);
+  printf("  16 x Button::isPressed() counted %lu presses  |  host time per scan: group %.0f ns,"
+         " 16 Buttons %.0f ns\n",
+         singlePresses, scanNs / scans, singleNs / scans);
+  simExpect(wrong == 0, "ButtonGroup event counts match the script");
+}
+
+/**
+ * @brief 32 LEDs on one LedSequencer ticked every 125 us, as from a timer
+ * ISR. Pin levels are sampled every tick to measure the delivered duty
+ * cycle against the requested brightness; one LED blinks from a pattern
+ * table and its step interval is timed.
+ */
+#define SIM_LEDS 32
+
+static void runLedSequencer(float seconds) {
+  LedSequencer leds;
+  unsigned long onTicks[SIM_LEDS];
+  int lastPin[SIM_LEDS];
+  int i;
+
+  hostSetMicros(0);
+  i = 0;
+  while (i < SIM_LEDS)
+  {
+    leds.add(40 + i, (i & 1) != 0); // Odd LEDs active-low
+    onTicks[i] = 0;
+    lastPin[i] = hostGetPin(40 + i);
+    i++;
+  }
+  leds.begin(125);
+  i = 1;
+  while (i < SIM_LEDS)
+  {
+    leds.setBrightness(i, (uint8_t)(i * 8 + 4));
+    i++;
+  }
+  leds.setPattern(0, LED_BLINK_FAST);
+
+  unsigned long ticks = (unsigned long)(seconds * 8000.0f);
+  unsigned long pinChanges = 0, steps = 0, t;
+  uint8_t lastLevel = leds.getBrightness(0);
+  uint64_t lastStepAt = 0, stepSum = 0;
+  double tickNs = 0.0, tickMaxNs = 0.0;
+  t = 0;
+  while (t < ticks)
+  {
+    hostAdvanceMicros(125);
+    std::chrono::steady_clock::time_point a = std::chrono::steady_clock::now();
+    leds.tick();
+    std::chrono::steady_clock::time_point b = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(b - a).count();
+    tickNs += ns;
+    if (ns > tickMaxNs && t > 100)
+      tickMaxNs = ns;
+
+    i = 0;
+    while (i < SIM_LEDS)
+    {
+      int level = hostGetPin(40 + i);
+      bool lit = (i & 1) ? (level == LOW) : (level == HIGH);
+      if (lit)
+        onTicks[i]++;
+      if (level != lastPin[i])
+        pinChanges++;
+      lastPin[i] = level;
+      i++;
+    }
+
+    if (leds.getBrightness(0) != lastLevel)
+    {
+      lastLevel = leds.getBrightness(0);
+      if (lastStepAt != 0)
+      {
+        stepSum += hostMicros() - lastStepAt;
+        steps++;
+      }
+      lastStepAt = hostMicros();
+    }
+    t++;
+  }
+
+  double maxErr = 0.0;
+  i = 1;
+  while (i < SIM_LEDS)
+  {
+    double want = (double)((i * 8 + 4) >> (8 - LED_SEQ_BITS)) / LED_SEQ_FRAME;
+    double got = (double)onTicks[i] / ticks;
+    if (fabs(got - want) > maxErr)
+      maxErr = fabs(got - want);
+    i++;
+  }
+
+  printf("LedSequencer %d LEDs %.0f s: duty error max %.4f  pattern step %.1f ms (want 100)"
+         "  pin changes/frame %.1f  host tick mean %.0f ns max %.0f ns\n",
+         SIM_LEDS, seconds, maxErr, steps ? stepSum / 1000.0 / steps : 0.0,
+         (double)pinChanges * LED_SEQ_FRAME / ticks, tickNs / ticks, tickMaxNs);
+  simExpect(maxErr < 0.01, "LED duty cycle within 1 % of the requested brightness");
+  simExpect(steps > 0 && fabs(stepSum / 1000.0 / steps - 100.0) < 1.0, "pattern step 100 ms");
+}
+
+int main() {
+  printf("RobotisTools sensor simulation\n");
+
+  runSonarArray(8, 1, 20.0f, true, 5.0f);
+  runSonarArray(8, 2, 20.0f, true, 5.0f);
+  runSonarArray(4, 1, 35.0f, false, 5.0f);
+  runSonarArray(4, 1, 35.0f, true, 5.0f);
+  runAnalogSampler(false, 104, 3.0f);
+  runAnalogSampler(true, 104, 3.0f);
+  runAnalogSampler(false, 10, 3.0f);
+  runAnalogSampler(true, 10, 3.0f);
+  runBatteryMonitor(200.0f);
+  runOversampling();
+  runOversampledThreshold();
+  runThresholdLatency(0, 200);
+  runThresholdLatency(1, 200);
+  runThresholdLatency(2, 200);
+  runButtonGroup(20);
+  runLedSequencer(5.0f);
+  return simExitCode();
+}
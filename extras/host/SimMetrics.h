@@ -0,0 +1,177 @@
+/**
+ * @file SimMetrics.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Step-Response Metrics, Controller CPU Cost and Pass / Fail Checks
+ * for Host Simulation.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef HOST_SIM_METRICS_H
+#define HOST_SIM_METRICS_H
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+#endif
+
+/**
+ * @brief Streams (t, y) samples of a step response and keeps O(1) metrics:
+ * overshoot, rise time (10-90%), settling time (last exit from the band),
+ * integral of time-weighted absolute error (ITAE) and saturation time.
+ */
+class StepMetrics {
+  private:
+    float _start;        // Value before the step
+    float _target;       // Setpoint after the step
+    float _band;         // Settling band as a fraction of the step size
+    float _peak;         // Furthest progress in the step direction (1.0 = target)
+    float _t10, _t90;    // First crossings of 10% / 90%
+    float _lastOutside;  // Last time outside the band
+    float _lastT;
+    float _itae;
+    float _saturated;    // Seconds spent at the actuator limit
+
+  public:
+    StepMetrics(float start, float target, float band = 0.02) {
+      _start = start;
+      _target = target;
+      _band = band;
+      _peak = 0.0f;
+      _t10 = -1.0f;
+      _t90 = -1.0f;
+      _lastOutside = 0.0f;
+      _lastT = 0.0f;
+      _itae = 0.0f;
+      _saturated = 0.0f;
+    }
+
+    /**
+     * @brief Adds one sample.
+     * @param t Time since the step (s).
+     * @param y Plant output.
+     * @param saturated True if the controller output is at a limit.
+     */
+    void add(float t, float y, bool saturated = false) {
+      float span = _target - _start;
+      float progress = (span != 0.0f) ? (y - _start) / span : 1.0f;
+      float dt = t - _lastT;
+
+      if (progress > _peak)
+        _peak = progress;
+      if (_t10 < 0.0f && progress >= 0.1f)
+        _t10 = t;
+      if (_t90 < 0.0f && progress >= 0.9f)
+        _t90 = t;
+      if (fabsf(y - _target) > _band * fabsf(span))
+        _lastOutside = t;
+
+      _itae += t * fabsf(_target - y) * dt;
+      if (saturated)
+        _saturated += dt;
+      _lastT = t;
+    }
+
+    /**
+     * @brief Overshoot as a percentage of the step size.
+     */
+    float overshoot() const {
+      return (_peak > 1.0f) ? (_peak - 1.0f) * 100.0f : 0.0f;
+    }
+
+    float riseTime() const { return (_t10 >= 0.0f && _t90 >= 0.0f) ? _t90 - _t10 : -1.0f; }
+
+    /**
+     * @brief Time after which the output stays inside the band (-1 if never).
+     */
+    float settlingTime() const {
+      if (_lastOutside >= _lastT)
+        return -1.0f;
+      return _lastOutside;
+    }
+
+    float itae() const { return _itae; }
+    float saturationTime() const { return _saturated; }
+};
+
+/**
+ * @brief Accumulates wall-clock time spent inside controller code.
+ */
+class CpuMeter {
+  private:
+    std::chrono::steady_clock::time_point _t0;
+    double _totalNs;
+    unsigned long _calls;
+
+  public:
+    CpuMeter() : _totalNs(0.0), _calls(0) {}
+
+    void start() { _t0 = std::chrono::steady_clock::now(); }
+
+    void stop() {
+      std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+      _totalNs += std::chrono::duration<double, std::nano>(t1 - _t0).count();
+      _calls++;
+    }
+
+    double nsPerCall() const { return _calls ? _totalNs / (double)_calls : 0.0; }
+    unsigned long calls() const { return _calls; }
+};
+
+/**
+ * @brief Time-stamp counter (x86 reference cycles), 0 elsewhere.
+ * Finer than CpuMeter for code that runs in a few nanoseconds.
+ */
+inline uint64_t simCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+/**
+ * @brief Failed checks so far in this process.
+ */
+inline int& simFailures() {
+  static int failures = 0;
+  return failures;
+}
+
+/**
+ * @brief Checks one threshold; prints the failed condition.
+ * @return ok, so callers can chain or branch on it.
+ */
+inline bool simExpect(bool ok, const char* what) {
+  if (!ok)
+  {
+    simFailures()++;
+    printf("  FAIL: %s\n", what);
+  }
+  return ok;
+}
+
+/**
+ * @brief Summary line and process exit code (0 = every check passed),
+ * so scripts and CI can run the simulations as regression tests.
+ */
+inline int simExitCode() {
+  if (simFailures() > 0)
+  {
+    printf("%d check(s) FAILED\n", simFailures());
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
+
+#endif
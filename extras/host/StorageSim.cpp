@@ -0,0 +1,331 @@
+/**
+ * @file StorageSim.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Host Simulation of EEPROM Persistence: Power Loss and Wear.
+ * Runs the real ConfigStore and ParamStore against the host EEPROM, which
+ * counts writes per cell and can drop all writes after a chosen one
+ * (power cut). With a per-byte programming time it also measures how
+ * long the main loop is blocked by background saves.
+ *
+ * Usage: storage_sim
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "RobotisTools.h"
+#include "SimMetrics.h"
+
+struct TripData {
+  uint32_t trips;
+  float odometerKm;
+  int16_t calibration[4];
+  char name[12]; // No padding: same() compares raw bytes
+};
+
+static const TripData DEFAULTS = {0, 0.0f, {0, 0, 0, 0}, "default"};
+
+static bool same(const TripData& a, const TripData& b) {
+  return memcmp(&a, &b, sizeof(TripData)) == 0;
+}
+
+static TripData makeTrip(uint32_t n) {
+  TripData t = DEFAULTS;
+  t.trips = n;
+  t.odometerKm = 0.25f * (float)n;
+  t.calibration[n % 4] = (int16_t)(n * 7);
+  snprintf(t.name, sizeof(t.name), "trip%u", (unsigned)n);
+  return t;
+}
+
+/**
+ * @brief Cuts power after every possible write of a save and reboots.
+ * A correct layout always boots into the old or the new copy. Every slot
+ * already holds an older copy, so the save overwrites a valid one (an
+ * older copy booting counts as torn too).
+ */
+static void runPowerLoss(uint8_t slots) {
+  int cut = 0, oldCopy = 0, newCopy = 0, defaults = 0, torn = 0;
+  TripData a = makeTrip(41);
+  TripData b = makeTrip(42);
+  uint8_t n;
+
+  for (;;)
+  {
+    EEPROM.clear();
+    {
+      ConfigStore<TripData> store(0, DEFAULTS, slots, 1);
+      store.load();
+      for (n = 0; n < slots; n++)
+        store.save(makeTrip(30 + n));
+      store.save(a);
+      EEPROM.hostResetWear();
+      EEPROM.hostFailAfter(cut);
+      store.save(b);
+      EEPROM.hostFailAfter(-1);
+    }
+    bool finished = EEPROM.hostTotalWrites() < (uint32_t)cut;
+
+    ConfigStore<TripData> rebooted(0, DEFAULTS, slots, 1); // Power back on
+    TripData got = rebooted.load();
+    if (same(got, a))
+      oldCopy++;
+    else if (same(got, b))
+      newCopy++;
+    else if (same(got, DEFAULTS))
+      defaults++;
+    else
+      torn++;
+
+    if (finished)
+      break;
+    cut++;
+  }
+  printf("Power loss  slots %d  %3d cut points: old copy %3d  new copy %3d  defaults %d  TORN %d\n",
+         slots, cut + 1, oldCopy, newCopy, defaults, torn);
+  if (slots > 0)
+    simExpect(torn == 0 && defaults == 0, "every cut point boots into the old or the new copy");
+}
+
+/**
+ * @brief Blank EEPROM, a wrong layout version and a flipped bit.
+ */
+static void runValidation() {
+  EEPROM.clear();
+  ConfigStore<TripData> blank(0, DEFAULTS, 2, 1);
+  TripData got = blank.load();
+  printf("Blank EEPROM      -> %s (valid %d)\n", same(got, DEFAULTS) ? "defaults" : "GARBAGE", blank.isValid());
+  simExpect(same(got, DEFAULTS) && !blank.isValid(), "blank EEPROM loads the defaults");
+
+  blank.save(makeTrip(1));
+  blank.save(makeTrip(2));
+  ConfigStore<TripData> otherVersion(0, DEFAULTS, 2, 2);
+  got = otherVersion.load();
+  printf("Version mismatch  -> %s (valid %d)\n", same(got, DEFAULTS) ? "defaults" : "STALE", otherVersion.isValid());
+  simExpect(same(got, DEFAULTS) && !otherVersion.isValid(), "version mismatch loads the defaults");
+
+  // Newest copy is in slot 1 (sequence 2): corrupt one payload byte
+  int addr = blank.footprint() / 2 + CONFIG_HEADER_SIZE + 3;
+  EEPROM.write(addr, EEPROM.read(addr) ^ 0x10);
+  ConfigStore<TripData> corrupted(0, DEFAULTS, 2, 1);
+  got = corrupted.load();
+  printf("Corrupted newest  -> %s\n", same(got, makeTrip(1)) ? "previous copy" : "WRONG");
+  simExpect(same(got, makeTrip(1)), "corrupted newest copy falls back to the previous one");
+
+  corrupted.save(makeTrip(3));
+  corrupted.factoryReset();
+  ConfigStore<TripData> reset(0, DEFAULTS, 2, 1);
+  got = reset.load();
+  printf("factoryReset      -> %s\n", same(got, DEFAULTS) ? "defaults" : "WRONG");
+  simExpect(same(got, DEFAULTS), "factoryReset loads the defaults");
+}
+
+/**
+ * @brief Persists a changing trip record many times; reports the busiest cell.
+ */
+static void runWear(uint8_t slots, uint32_t saves) {
+  uint32_t n;
+
+  EEPROM.clear();
+  ConfigStore<TripData> store(0, DEFAULTS, slots, 1);
+  store.load();
+  EEPROM.hostResetWear();
+  for (n = 1; n <= saves; n++)
+    store.save(makeTrip(n));
+
+  printf("Wear        slots %d  %lu saves: %lu byte writes (%.1f per save), busiest cell %lu writes\n",
+         slots, (unsigned long)saves, (unsigned long)EEPROM.hostTotalWrites(),
+         (double)EEPROM.hostTotalWrites() / saves, (unsigned long)EEPROM.hostMaxWrites());
+  if (slots > 0)
+    simExpect(EEPROM.hostMaxWrites() <= saves / slots + 1, "no cell written more than once per save of its slot");
+}
+
+/**
+ * @brief saveAsync() serviced from a 1 ms loop while every EEPROM byte
+ * programs for 3.3 ms (AVR) and blocks any access meanwhile. Reports the
+ * worst time one tick spent inside service(), against a blocking save().
+ */
+static void runAsyncSave(int budget) {
+  TripData a = makeTrip(7);
+  TripData b = makeTrip(8);
+  uint64_t worst = 0, t0;
+  unsigned long ticks = 0, written = 0;
+
+  EEPROM.clear();
+  hostSetMicros(0);
+  EEPROM.hostSetWriteTime(3300);
+  ConfigStore<TripData> store(0, DEFAULTS, 2, 1);
+  store.load();
+
+  t0 = hostMicros();
+  store.save(a);
+  uint64_t blocking = hostMicros() - t0;
+
+  hostAdvanceMicros(10000); // Let the last byte finish
+  uint64_t start = hostMicros();
+  store.saveAsync(b);
+  while (store.isPending())
+  {
+    t0 = hostMicros();
+    written += store.service(budget);
+    if (hostMicros() - t0 > worst)
+      worst = hostMicros() - t0;
+    ticks++;
+    hostAdvanceMicros(1000); // Rest of the loop
+  }
+  uint64_t done = hostMicros() - start;
+  EEPROM.hostSetWriteTime(0);
+
+  ConfigStore<TripData> rebooted(0, DEFAULTS, 2, 1);
+  bool ok = same(rebooted.load(), b);
+  printf("Async save  budget %d, 3.3 ms/byte, 1 ms loop: %lu bytes in %.1f ms over %lu ticks,"
+         " worst tick blocked %lu us (blocking save() %.1f ms), reboot %s\n",
+         budget, written, done / 1000.0, ticks, (unsigned long)worst, blocking / 1000.0,
+         ok ? "ok" : "WRONG");
+  simExpect(worst == 0, "service() never waits for the EEPROM");
+  simExpect(ok, "async save lands in EEPROM");
+}
+
+#define PS_ADDRESS 0
+#define PS_SIZE    256
+#define PS_KEYS    12
+
+/**
+ * @brief Expected value of key k after `round` updates of key 0.
+ */
+static float paramValue(int key, int round) {
+  return (key == 0) ? 1.5f + (float)round : 100.0f + (float)key;
+}
+
+static void fillParams(ParamStore& ps) {
+  int k;
+  for (k = 0; k < PS_KEYS; k++)
+    ps.setFloat((uint8_t)k, paramValue(k, 0));
+  ps.setBlob(PS_KEYS, "robotis", 7);
+}
+
+/**
+ * @brief Write cost of updating one parameter, and compaction behaviour.
+ */
+static void runParamCost(int updates) {
+  int r, compactions = 0;
+
+  EEPROM.clear();
+  ParamStore ps(PS_ADDRESS, PS_SIZE);
+  ps.begin();
+  fillParams(ps);
+
+  EEPROM.hostResetWear();
+  for (r = 1; r <= updates; r++)
+  {
+    int before = ps.freeBytes();
+    ps.setFloat(0, paramValue(0, r));
+    if (ps.freeBytes() > before)
+      compactions++;
+  }
+  uint32_t writes = EEPROM.hostTotalWrites();
+
+  // Unchanged value: must not write
+  EEPROM.hostResetWear();
+  ps.setFloat(0, paramValue(0, updates));
+  uint32_t unchanged = EEPROM.hostTotalWrites();
+
+  // Reboot: index rebuilt from the log
+  ParamStore again(PS_ADDRESS, PS_SIZE);
+  again.begin();
+  bool ok = again.getFloat(0, -1.0f) == paramValue(0, updates);
+  int k;
+  for (k = 1; k < PS_KEYS; k++)
+    ok = ok && again.getFloat((uint8_t)k, -1.0f) == paramValue(k, 0);
+  char name[8] = {0};
+  ok = ok && again.getBlob(PS_KEYS, name, 7) == 7 && memcmp(name, "robotis", 7) == 0;
+
+  printf("ParamStore  %d updates of 1 of %d params: %.1f byte writes per update"
+         " (%d compactions), unchanged set %lu writes, reboot %s\n",
+         updates, PS_KEYS + 1, (double)writes / updates, compactions,
+         (unsigned long)unchanged, ok ? "ok" : "WRONG");
+  simExpect(ok, "ParamStore reboot restores every key");
+  simExpect(unchanged == 0, "ParamStore unchanged set does not write");
+}
+
+/**
+ * @brief Power cut after every write of a set that forces a compaction.
+ * After reboot, the updated key must hold its old or new value and every
+ * other key its unchanged value.
+ */
+static void runParamPowerLoss() {
+  int cut = 0, oldValue = 0, newValue = 0, broken = 0, round;
+
+  for (;;)
+  {
+    EEPROM.clear();
+    {
+      ParamStore ps(PS_ADDRESS, PS_SIZE);
+      ps.begin();
+      fillParams(ps);
+      // Fill the bank until the next set has to compact
+      round = 1;
+      while (ps.freeBytes() >= PARAM_RECORD_OVERHEAD + 4)
+      {
+        ps.setFloat(0, paramValue(0, round));
+        round++;
+      }
+      EEPROM.hostResetWear();
+      EEPROM.hostFailAfter(cut);
+      ps.setFloat(0, paramValue(0, round));
+      EEPROM.hostFailAfter(-1);
+    }
+    bool finished = EEPROM.hostTotalWrites() < (uint32_t)cut;
+
+    ParamStore rebooted(PS_ADDRESS, PS_SIZE);
+    rebooted.begin();
+    float v = rebooted.getFloat(0, -1.0f);
+    bool others = true;
+    int k;
+    for (k = 1; k < PS_KEYS; k++)
+      others = others && rebooted.getFloat((uint8_t)k, -1.0f) == paramValue(k, 0);
+
+    if (!others)
+      broken++;
+    else if (v == paramValue(0, round - 1))
+      oldValue++;
+    else if (v == paramValue(0, round))
+      newValue++;
+    else
+      broken++;
+
+    if (finished)
+      break;
+    cut++;
+  }
+  printf("ParamStore  power cut during compaction, %3d cut points: old %3d  new %3d  BROKEN %d\n",
+         cut + 1, oldValue, newValue, broken);
+  simExpect(broken == 0, "ParamStore survives a power cut during compaction");
+}
+
+int main() {
+  printf("RobotisTools storage simulation (ConfigStore, %d-byte record)\n", (int)sizeof(TripData));
+
+  runPowerLoss(0);
+  runPowerLoss(2);
+  runPowerLoss(4);
+  runValidation();
+
+  runWear(0, 10000);
+  runWear(2, 10000);
+  runWear(8, 10000);
+
+  runAsyncSave(1);
+  runAsyncSave(8);
+
+  runParamCost(10000);
+  runParamPowerLoss();
+  return simExitCode();
+}
@@ -0,0 +1,113 @@
+/**
+ * @file WorkStealingPool.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Work-Stealing Thread Pool for Host-Side Batch Jobs.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef HOST_WORK_STEALING_POOL_H
+#define HOST_WORK_STEALING_POOL_H
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Runs job(0) .. job(count-1) on all cores.
+ * Each worker owns a deque of job indices: it pops from the back (cache-warm,
+ * contiguous ranges) and, once empty, steals from the front of a victim's
+ * deque. Long and short jobs (stable vs. diverging simulations) balance out.
+ */
+class WorkStealingPool {
+  private:
+    struct Queue {
+      std::mutex lock;
+      std::deque<size_t> jobs;
+    };
+
+    unsigned _threads;
+
+    static bool popBack(Queue& q, size_t& job) {
+      std::lock_guard<std::mutex> guard(q.lock);
+      if (q.jobs.empty())
+        return false;
+      job = q.jobs.back();
+      q.jobs.pop_back();
+      return true;
+    }
+
+    static bool stealFront(Queue& q, size_t& job) {
+      std::lock_guard<std::mutex> guard(q.lock);
+      if (q.jobs.empty())
+        return false;
+      job = q.jobs.front();
+      q.jobs.pop_front();
+      return true;
+    }
+
+  public:
+    /**
+     * @param threads Worker count (0 = all hardware threads).
+     */
+    WorkStealingPool(unsigned threads = 0) {
+      _threads = threads ? threads : std::thread::hardware_concurrency();
+      if (_threads == 0)
+        _threads = 1;
+    }
+
+    unsigned threads() const { return _threads; }
+
+    /**
+     * @brief Executes every job once and returns when all are done.
+     */
+    void run(size_t count, const std::function<void(size_t)>& job) {
+      std::vector<Queue> queues(_threads);
+      std::vector<std::thread> workers;
+      size_t i;
+
+      // Contiguous initial split: neighbours in the grid run on the same core
+      i = 0;
+      while (i < count)
+      {
+        queues[i * _threads / count].jobs.push_back(i);
+        i++;
+      }
+
+      unsigned w;
+      for (w = 0; w < _threads; w++)
+      {
+        workers.push_back(std::thread([&queues, &job, w, this]() {
+          size_t next;
+          for (;;)
+          {
+            if (popBack(queues[w], next))
+            {
+              job(next);
+              continue;
+            }
+            // Own queue is empty: try every victim once, starting at a neighbour
+            bool stole = false;
+            unsigned k;
+            for (k = 1; k < _threads && !stole; k++)
+              stole = stealFront(queues[(w + k) % _threads], next);
+            if (!stole)
+              return; // Nothing left anywhere (jobs never spawn new jobs)
+            job(next);
+          }
+        }));
+      }
+      for (w = 0; w < _threads; w++)
+        workers[w].join();
+    }
+};
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * @file Delegate.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Fixed-Size Callback for Functions, Member Functions and Lambdas.
+ * Lets TaskManager, SerialCommander and TimerWheel call `sonar.update()`
+ * or a small lambda directly, without global wrapper functions, heap
+ * allocation or virtual dispatch.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef DELEGATE_H
+#define DELEGATE_H
+
+#include <Arduino.h>
+#include <string.h>
+
+// Plain function callback (still accepted everywhere a Callback is)
+typedef void (*VoidFunction)();
+
+#define CALLBACK_WORDS 3 // Storage in pointers: object + member function pointer
+
+// No <type_traits> on AVR
+template <bool B, class T = void> struct CallbackEnableIf {};
+template <class T> struct CallbackEnableIf<true, T> { typedef T type; };
+template <class A, class B> struct CallbackIsSame { static const bool value = false; };
+template <class A> struct CallbackIsSame<A, A> { static const bool value = true; };
+
+// Lambdas are copied with memcpy, so they must be trivially copyable
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+  #define CALLBACK_IS_TRIVIAL(F) __is_trivially_copyable(F)
+#elif defined(__GNUC__)
+  #define CALLBACK_IS_TRIVIAL(F) (__has_trivial_copy(F) && __has_trivial_destructor(F))
+#else
+  #define CALLBACK_IS_TRIVIAL(F) true // No compiler trait: rule is unchecked
+#endif
+
+/**
+ * @brief A `void()` callable in CALLBACK_WORDS pointers plus one stub pointer.
+ *
+ * A call is one indirect call to a stub that knows the stored type, so:
+ * - Callback::bind<T, &T::method>(&obj): the member call is inlined into
+ *   the stub; same cost as calling a raw function pointer.
+ * - Callback(&obj, &T::method): stores the member function pointer; one
+ *   more indirect call, shorter to write.
+ * - Callback(lambda): the lambda is copied into the internal buffer. It
+ *   must fit (captures of a few pointers / numbers) and be trivially
+ *   copyable, i.e. capture plain values or references, not objects with
+ *   their own copy constructor. Either violation fails to compile.
+ * - Callback(function): a plain VoidFunction, called directly without a
+ *   stub (operator() checks for it first), so it costs what a raw
+ *   function pointer does.
+ *
+ * sizeof(Callback): 8 bytes on AVR (3 + 1 two-byte pointers), 24 on
+ * 32-bit ARM (the buffer is 8-byte aligned for double / long long
+ * captures), 32 on 64-bit hosts.
+ *
+ * The stored object must outlive the callback (it is not copied).
+ *
+ * Usage Example:
+ * app.addTask(Callback(&sonar, &AsyncSonar::update), 0);
+ * app.addTask(Callback::bind<FastPID, &FastPID::reset>(&pid), 1000);
+ * app.addCommand("dark", [&leds]() { leds.off(0); });
+ * app.addTask(taskBlink, 500); // Plain functions as before
+ */
+class Callback {
+  private:
+    union Storage {
+      void* words[CALLBACK_WORDS];
+      VoidFunction function;
+#if !defined(__AVR__) // AVR has no alignment; these would only add size
+      long long alignWide;
+      double alignDouble;
+#endif
+    };
+
+    template <class T>
+    struct MemberCall {
+      T* object;
+      void (T::*method)();
+    };
+
+    typedef void (*Stub)(Storage& storage);
+
+    mutable Storage _storage; // Lambdas may be `mutable`
+    Stub _stub;
+
+    static void emptyStub(Storage&) {}
+
+    static void functionStub(Storage& s) {
+      s.function();
+    }
+
+    template <class T, void (T::*Method)()>
+    static void boundStub(Storage& s) {
+      (static_cast<T*>(s.words[0])->*Method)();
+    }
+
+    template <class T>
+    static void memberStub(Storage& s) {
+      MemberCall<T>* call = reinterpret_cast<MemberCall<T>*>(&s);
+      (call->object->*(call->method))();
+    }
+
+    template <class F>
+    static void lambdaStub(Storage& s) {
+      (*reinterpret_cast<F*>(&s))();
+    }
+
+  public:
+    /**
+     * @brief Empty callback; calling it does nothing.
+     */
+    Callback() {
+      _stub = emptyStub;
+    }
+
+    /**
+     * @brief Plain function (NULL gives an empty callback).
+     */
+    Callback(VoidFunction function) {
+      _storage.function = function;
+      _stub = (function != NULL) ? functionStub : emptyStub;
+    }
+
+    /**
+     * @brief Member function of an object.
+     */
+    template <class T>
+    Callback(T* object, void (T::*method)()) {
+      static_assert(sizeof(MemberCall<T>) <= sizeof(Storage), "Member function pointer too large");
+      MemberCall<T> call;
+      call.object = object;
+      call.method = method;
+      memcpy(&_storage, &call, sizeof(call));
+      _stub = memberStub<T>;
+    }
+
+    /**
+     * @brief Lambda or other function object, copied into the buffer.
+     */
+    template <class F, class = typename CallbackEnableIf<!CallbackIsSame<F, Callback>::value>::type>
+    Callback(const F& function) {
+      static_assert(sizeof(F) <= sizeof(Storage), "Lambda captures too much for Callback");
+      static_assert(CALLBACK_IS_TRIVIAL(F), "Lambda captures must be trivially copyable");
+      memcpy(&_storage, &function, sizeof(F));
+      _stub = lambdaStub<F>;
+    }
+
+    /**
+     * @brief Member function fixed at compile time (fastest form).
+     */
+    template <class T, void (T::*Method)()>
+    static Callback bind(T* object) {
+      Callback c;
+      c._storage.words[0] = object;
+      c._stub = boundStub<T, Method>;
+      return c;
+    }
+
+    void operator()() const {
+      // Plain functions skip the stub hop
+      if (_stub == functionStub)
+        _storage.function();
+      else
+        _stub(_storage);
+    }
+
+    bool isEmpty() const {
+      return _stub == emptyStub;
+    }
+};
+
+#endif
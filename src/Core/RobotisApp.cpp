@@ -2,7 +2,7 @@
  * @file RobotisApp.cpp
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief Implementation of RobotisApp Kernel.
- * @version 1.0.0
+ * @version 1.3.0
  * @date 2025-12-30
  *
  * @copyright Copyright (c) 2025 Furkan
@@ -19,6 +19,8 @@
  */
 RobotisApp::RobotisApp(long baudRate) : _logger(baudRate) {
   _baudRate = baudRate;
+  _configCount = 0;
+  _eepromBudget = 1;
   // Note: TaskManager and SerialCommander are initialized automatically
   // by their default constructors.
 }
@@ -27,6 +29,8 @@ RobotisApp::RobotisApp(long baudRate) : _logger(baudRate) {
  * @brief Starts the system.
  */
 void RobotisApp::begin() {
+  TickClock::begin();
+
   // Start Logger (which starts Serial)
   _logger.begin();
   
@@ -44,22 +48,48 @@ void RobotisApp::begin() {
  * @brief The Heartbeat of the system.
  */
 void RobotisApp::update() {
-  _scheduler.run(); // Process scheduled tasks
-  _cli.check();     // Check for incoming serial commands
+  TickClock::sample();               // One time reading for the whole tick
+  _scheduler.run(TickClock::ms());   // Process scheduled tasks
+  _timers.update(TickClock::ms());   // Fire due timers
+  _cli.check();                      // Check for incoming serial commands
+
+  // Background EEPROM writes, shared budget, first pending store first
+  int budget = _eepromBudget;
+  int i;
+
+  i = 0;
+  while (i < _configCount && budget > 0)
+  {
+    if (_configs[i]->isPending())
+      budget -= _configs[i]->service(budget);
+    i++;
+  }
 }
 
 // =============================================================================
 // API PROXIES IMPLEMENTATION
 // =============================================================================
 
-void RobotisApp::addTask(VoidFunction callback, unsigned long interval) {
+void RobotisApp::addTask(const Callback& callback, unsigned long interval) {
   _scheduler.addTask(callback, interval);
 }
 
-void RobotisApp::addCommand(const char* name, VoidFunction callback) {
+void RobotisApp::addCommand(const char* name, const Callback& callback) {
   _cli.addCommand(name, callback);
 }
 
+TimerHandle RobotisApp::startTimer(const Callback& callback, unsigned long delay, unsigned long period) {
+  return _timers.start(callback, delay, period);
+}
+
+bool RobotisApp::cancelTimer(TimerHandle handle) {
+  return _timers.cancel(handle);
+}
+
+bool RobotisApp::restartTimer(TimerHandle handle) {
+  return _timers.restart(handle);
+}
+
 void RobotisApp::log(const char* msg) {
   _logger.info(msg);
 }
@@ -68,6 +98,18 @@ void RobotisApp::log(const char* msg, int val) {
   _logger.info(msg, val);
 }
 
+void RobotisApp::addConfig(ConfigStoreBase& store) {
+  if (_configCount < APP_MAX_CONFIGS)
+  {
+    _configs[_configCount] = &store;
+    _configCount++;
+  }
+}
+
+void RobotisApp::setEepromBudget(int bytes) {
+  _eepromBudget = (bytes < 1) ? 1 : bytes;
+}
+
 Logger& RobotisApp::getLogger() {
   return _logger;
 }
\ No newline at end of file
@@ -3,7 +3,7 @@
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief Main Application Kernel for RobotisTools Framework.
  * Acts as a Facade to manage TaskManager, SerialCommander, and Logger.
- * @version 1.0.0
+ * @version 1.3.2
  * @date 2025-12-30
  *
  * @copyright Copyright (c) 2025 Furkan
@@ -22,6 +22,16 @@
 #include "TaskManager.h"
 #include "SerialCommander.h"
 #include "Logger.h"
+#include "TickClock.h"
+#include "TimerWheel.h"
+#include "../Utils/ConfigStore.h"
+
+#define APP_MAX_CONFIGS 4 // ConfigStores serviced in the background
+#if defined(__AVR__)
+  #define APP_MAX_TIMERS 8 // Timers armed at once (startTimer)
+#else
+  #define APP_MAX_TIMERS 32
+#endif
 
 /**
  * @brief The Kernel class that orchestrates the entire system.
@@ -32,8 +42,13 @@ class RobotisApp {
     TaskManager _scheduler;       // Manages periodic tasks
     SerialCommander _cli;         // Manages Serial commands
     Logger _logger;               // Manages logging output
+    TimerWheel<APP_MAX_TIMERS> _timers; // One-shot / periodic timers
     long _baudRate;               // Serial communication speed
 
+    ConfigStoreBase* _configs[APP_MAX_CONFIGS]; // Background EEPROM writers
+    int _configCount;
+    int _eepromBudget;            // Max EEPROM bytes written per update()
+
   public:
     /**
      * @brief Construct a new Robotis App object.
@@ -53,6 +68,8 @@ class RobotisApp {
 
     /**
      * @brief Main system loop. Handles multitasking and CLI.
+     * Samples TickClock once first; tasks read the same time from
+     * TickClock::ms() / TickClock::us().
      * Must be called in loop().
      */
     void update();
@@ -63,17 +80,39 @@ class RobotisApp {
 
     /**
      * @brief Schedules a task to run repeatedly.
-     * @param callback Function to call.
+     * @param callback Function to call: a plain function, a member
+     * (Callback(&obj, &Class::method)) or a small lambda.
      * @param interval Time in ms between calls.
      */
-    void addTask(VoidFunction callback, unsigned long interval);
+    void addTask(const Callback& callback, unsigned long interval);
 
     /**
      * @brief Registers a new Serial text command.
      * @param name Command string (e.g., "stop").
-     * @param callback Function to execute.
+     * @param callback Function, member function or lambda to execute.
+     */
+    void addCommand(const char* name, const Callback& callback);
+
+    /**
+     * @brief Arms a one-shot or periodic timer, fired from update().
+     * @param callback Function to call.
+     * @param delay Time in ms until the first call.
+     * @param period 0 = one-shot, otherwise repeat every `period` ms.
+     * @return TimerHandle for cancel / restart, TIMER_NONE if all
+     * APP_MAX_TIMERS are in use.
+     */
+    TimerHandle startTimer(const Callback& callback, unsigned long delay, unsigned long period = 0);
+
+    /**
+     * @brief Stops a timer (a stale handle is ignored).
      */
-    void addCommand(const char* name, VoidFunction callback);
+    bool cancelTimer(TimerHandle handle);
+
+    /**
+     * @brief Re-arms a timer with its last delay from now, e.g. to kick a
+     * "stop if no packet for 200 ms" watchdog.
+     */
+    bool restartTimer(TimerHandle handle);
 
     /**
      * @brief Logs a message via the Logger module.
@@ -88,6 +127,24 @@ class RobotisApp {
      */
     void log(const char* msg, int val);
 
+    /**
+     * @brief Registers a ConfigStore whose saveAsync() writes are carried
+     * out by update(), a few bytes per tick.
+     * @param store Any ConfigStore<T>.
+     */
+    void addConfig(ConfigStoreBase& store);
+
+    /**
+     * @brief Max EEPROM bytes written per update() across all stores.
+     * On AVR update() never waits for the EEPROM: a byte programs for
+     * ~3.3 ms, so at most one byte per ~3.3 ms is written whatever the
+     * budget. Other cores write up to `bytes` per tick at the core's own
+     * cost per write; on STM32 / OpenCM flash emulation one write may
+     * stall for a page erase (see ConfigStoreBase).
+     * @param bytes Budget per tick (Default: 1).
+     */
+    void setEepromBudget(int bytes);
+
     // =========================================================================
     // ACCESSORS (Gelişmiş ayarlar için alt modüllere doğrudan erişim)
     // =========================================================================
@@ -10,7 +10,7 @@ void SerialCommander::begin(long baudRate) {
   Serial.begin(baudRate);
 }
 
-void SerialCommander::addCommand(const char* name, VoidFunction callback) {
+void SerialCommander::addCommand(const char* name, const Callback& callback) {
   if (_cmdCount < MAX_COMMANDS)
   {
     _commands[_cmdCount].name = name;
@@ -2,19 +2,17 @@
 #define SERIAL_COMMANDER_H
 
 #include <Arduino.h>
+#include "Delegate.h"
 
 #define MAX_COMMANDS 10
 #define CMD_BUFFER_SIZE 32
 
-// Function pointer type for command callbacks
-typedef void (*VoidFunction)();
-
 /**
  * @brief Structure for mapping command strings to functions.
  */
 struct Command {
   const char* name;
-  VoidFunction callback;
+  Callback callback;
 };
 
 /**
@@ -40,9 +38,10 @@ class SerialCommander
     /**
      * @brief Registers a new command.
      * @param name Command string (e.g., "led_on"). Case-sensitive.
-     * @param callback Function to execute when command is received.
+     * @param callback Function, member function or lambda to execute when
+     * command is received.
      */
-    void addCommand(const char* name, VoidFunction callback);
+    void addCommand(const char* name, const Callback& callback);
 
     /**
      * @brief Checks Serial buffer for new commands. Must be called in loop().
@@ -4,7 +4,7 @@ TaskManager::TaskManager() {
   _taskCount = 0;
 }
 
-void TaskManager::addTask(VoidFunction callback, unsigned long interval) {
+void TaskManager::addTask(const Callback& callback, unsigned long interval) {
   if (_taskCount < MAX_TASKS) 
   {
     _tasks[_taskCount].func = callback;
@@ -19,7 +19,10 @@ void TaskManager::addTask(VoidFunction callback, unsigned long interval) {
  * @brief Main scheduler loop. Checks all tasks and runs them if due.
  */
 void TaskManager::run() {
-  unsigned long currentMillis = millis();
+  run(millis());
+}
+
+void TaskManager::run(unsigned long currentMillis) {
   int i;
 
   i = 0;
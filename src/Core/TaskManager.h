@@ -2,9 +2,7 @@
 #define TASK_MANAGER_H
 
 #include <Arduino.h>
-
-// Function pointer type for tasks
-typedef void (*VoidFunction)();
+#include "Delegate.h"
 
 #define MAX_TASKS 10
 
@@ -12,7 +10,7 @@ typedef void (*VoidFunction)();
  * @brief Structure representing a single task.
  */
 struct Task {
-  VoidFunction func;
+  Callback func;
   unsigned long interval;
   unsigned long lastRun;
   bool active;
@@ -32,15 +30,21 @@ class TaskManager
 
     /**
      * @brief Adds a function to the scheduler.
-     * @param callback The void function to call.
+     * @param callback The void function, member function or lambda to call.
      * @param interval How often to call it (in milliseconds).
      */
-    void addTask(VoidFunction callback, unsigned long interval);
+    void addTask(const Callback& callback, unsigned long interval);
 
     /**
      * @brief Main loop runner. Must be called inside loop().
      */
     void run();
+
+    /**
+     * @brief Same as run(), with the tick's time (e.g. TickClock::ms()).
+     * @param now Current time in milliseconds.
+     */
+    void run(unsigned long now);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+/**
+ * @file TickClock.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of TickClock service.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "TickClock.h"
+
+ClockSource TickClock::_source = NULL;
+unsigned long TickClock::_lastRaw = 0;
+unsigned long TickClock::_usRem = 0;
+uint64_t TickClock::_us64 = 0;
+uint64_t TickClock::_ms64 = 0;
+bool TickClock::_started = false;
+
+void TickClock::begin() {
+  unsigned long raw = (_source != NULL) ? _source() : micros();
+  _lastRaw = raw;
+  _us64 = raw;
+  _ms64 = raw / 1000;
+  _usRem = raw % 1000;
+  _started = true;
+}
+
+void TickClock::sample() {
+  if (!_started)
+  {
+    begin();
+    return;
+  }
+
+  // 1. One read; unsigned subtraction is correct across a source wrap
+  unsigned long raw = (_source != NULL) ? _source() : micros();
+  unsigned long delta = (uint32_t)(raw - _lastRaw);
+  _lastRaw = raw;
+  _us64 += delta;
+
+  // 2. Carry whole milliseconds (32-bit division, at most once per tick)
+  _usRem += delta;
+  if (_usRem >= 1000)
+  {
+    unsigned long q = _usRem / 1000;
+    _ms64 += q;
+    _usRem -= q * 1000;
+  }
+}
+
+void TickClock::setSource(ClockSource source) {
+  _source = source;
+  begin();
+}
+
+unsigned long TickClock::ms() {
+  return (unsigned long)(uint32_t)_ms64;
+}
+
+unsigned long TickClock::us() {
+  return (unsigned long)(uint32_t)_us64;
+}
+
+uint64_t TickClock::ms64() {
+  return _ms64;
+}
+
+uint64_t TickClock::us64() {
+  return _us64;
+}
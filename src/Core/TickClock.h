@@ -0,0 +1,83 @@
+/**
+ * @file TickClock.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Shared Per-Tick Time Snapshot.
+ * Reads the time source once per tick and keeps it as 64-bit, wrap-safe
+ * microseconds and milliseconds, so every module in the same tick sees
+ * the same time without calling millis() / micros() again.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef TICK_CLOCK_H
+#define TICK_CLOCK_H
+
+#include <Arduino.h>
+
+// Microsecond time source (micros() or a virtual clock)
+typedef unsigned long (*ClockSource)();
+
+/**
+ * @brief Static clock service. RobotisApp::update() calls sample() once per
+ * tick; without RobotisApp, call it at the top of loop().
+ *
+ * One source read per sample: milliseconds are derived from the same
+ * microsecond reading, so ms() and us() never disagree. The 64-bit
+ * counters extend the 32-bit source as long as sample() runs at least
+ * once per source wrap (71 minutes for micros()).
+ *
+ * ms() / us() are the low 32 bits, drop-in for millis() / micros() and
+ * for the `now` overloads (TaskManager::run(now), SimpleTimer::isReady(now),
+ * Led::blink(interval, now), Button::isPressed(now), FastPID::compute(..., now)).
+ *
+ * Usage Example:
+ * TickClock::sample();                 // Once, top of loop()
+ * timer.isReady(TickClock::ms());
+ * TickClock::setSource(myVirtualMicros); // Host simulation
+ */
+class TickClock {
+  private:
+    static ClockSource _source;
+    static unsigned long _lastRaw;   // Last source reading
+    static unsigned long _usRem;     // Microseconds not yet counted in _ms64
+    static uint64_t _us64;
+    static uint64_t _ms64;
+    static bool _started;
+
+  public:
+    /**
+     * @brief Restarts the counters at the current source time.
+     */
+    static void begin();
+
+    /**
+     * @brief Reads the source once and advances the snapshot.
+     */
+    static void sample();
+
+    /**
+     * @brief Replaces the time source (NULL = micros()) and restarts.
+     */
+    static void setSource(ClockSource source);
+
+    /**
+     * @return Snapshot in ms, low 32 bits (millis() compatible).
+     */
+    static unsigned long ms();
+
+    /**
+     * @return Snapshot in us, low 32 bits (micros() compatible).
+     */
+    static unsigned long us();
+
+    static uint64_t ms64();
+    static uint64_t us64();
+};
+
+#endif
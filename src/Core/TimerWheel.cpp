@@ -0,0 +1,274 @@
+/**
+ * @file TimerWheel.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of TimerWheel.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "TimerWheel.h"
+
+#define TIMER_NIL          0xFFFF // End of list
+#define TIMER_LIST_FREE    0xFFFF // Node not linked anywhere
+#define TIMER_LIST_PENDING (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS) // Due this tick
+#define TIMER_SLOT_MASK    (TIMER_WHEEL_SLOTS - 1)
+#define TIMER_WHEEL_SPAN   (1UL << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS)) // ms
+
+TimerWheelBase::TimerWheelBase(TimerNode* nodes, uint16_t capacity) {
+  _nodes = nodes;
+  _capacity = capacity;
+  _free = TIMER_NIL;
+  _active = 0;
+  _now = 0;
+  _started = false;
+}
+
+void TimerWheelBase::clear() {
+  uint16_t i;
+
+  i = 0;
+  while (i <= TIMER_LIST_PENDING)
+  {
+    _heads[i] = TIMER_NIL;
+    i++;
+  }
+
+  // Chain the whole pool into the free list; old handles go stale
+  i = 0;
+  while (i < _capacity)
+  {
+    _nodes[i].list = TIMER_LIST_FREE;
+    _nodes[i].generation++;
+    if (_nodes[i].generation == 0)
+      _nodes[i].generation = 1;
+    _nodes[i].next = (i + 1 < _capacity) ? i + 1 : TIMER_NIL;
+    i++;
+  }
+  _free = (_capacity > 0) ? 0 : TIMER_NIL;
+  _active = 0;
+}
+
+TimerNode* TimerWheelBase::lookup(TimerHandle handle) {
+  uint16_t index = (uint16_t)(handle & 0xFFFF);
+  uint16_t generation = (uint16_t)(handle >> 16);
+  if (index >= _capacity || generation == 0)
+    return NULL;
+  TimerNode* n = &_nodes[index];
+  if (n->generation != generation || n->list == TIMER_LIST_FREE)
+    return NULL;
+  return n;
+}
+
+void TimerWheelBase::link(uint16_t index, uint16_t list) {
+  TimerNode& n = _nodes[index];
+  n.list = list;
+  n.prev = TIMER_NIL;
+  n.next = _heads[list];
+  if (n.next != TIMER_NIL)
+    _nodes[n.next].prev = index;
+  _heads[list] = index;
+}
+
+void TimerWheelBase::unlink(uint16_t index) {
+  TimerNode& n = _nodes[index];
+  if (n.prev != TIMER_NIL)
+    _nodes[n.prev].next = n.next;
+  else
+    _heads[n.list] = n.next;
+  if (n.next != TIMER_NIL)
+    _nodes[n.next].prev = n.prev;
+  n.list = TIMER_LIST_FREE;
+}
+
+/**
+ * @brief Links a node into the slot for its expiry, relative to _now.
+ */
+void TimerWheelBase::insert(uint16_t index) {
+  TimerNode& n = _nodes[index];
+  uint32_t delta = n.expires - _now;
+  uint32_t when = n.expires;
+  uint8_t level = 0;
+
+  // 1. Finest level whose span covers the delay
+  while (level < TIMER_WHEEL_LEVELS - 1 && delta >= (1UL << (TIMER_WHEEL_BITS * (level + 1))))
+    level++;
+
+  // 2. Beyond the wheel: park in the farthest top slot, re-inserted later
+  if (delta >= TIMER_WHEEL_SPAN - 1)
+    when = _now + TIMER_WHEEL_SPAN - 1;
+
+  uint16_t slot = (uint16_t)((when >> (TIMER_WHEEL_BITS * level)) & TIMER_SLOT_MASK);
+  link(index, level * TIMER_WHEEL_SLOTS + slot);
+}
+
+/**
+ * @brief Moves the current slot of a coarse level one level down.
+ */
+void TimerWheelBase::cascade(uint8_t level) {
+  uint16_t list = level * TIMER_WHEEL_SLOTS +
+                  (uint16_t)((_now >> (TIMER_WHEEL_BITS * level)) & TIMER_SLOT_MASK);
+  uint16_t i = _heads[list];
+  _heads[list] = TIMER_NIL;
+
+  while (i != TIMER_NIL)
+  {
+    uint16_t next = _nodes[i].next;
+    insert(i);
+    i = next;
+  }
+}
+
+void TimerWheelBase::release(uint16_t index) {
+  TimerNode& n = _nodes[index];
+  n.list = TIMER_LIST_FREE;
+  n.generation++;
+  if (n.generation == 0)
+    n.generation = 1;
+  n.next = _free;
+  _free = index;
+  _active--;
+}
+
+/**
+ * @brief Advances the wheel by 1 ms.
+ */
+void TimerWheelBase::step() {
+  _now++;
+
+  // 1. Cascade each coarse level whose period starts now
+  uint32_t t = _now;
+  uint8_t level = 1;
+  while (level < TIMER_WHEEL_LEVELS && (t & TIMER_SLOT_MASK) == 0)
+  {
+    t >>= TIMER_WHEEL_BITS;
+    cascade(level);
+    level++;
+  }
+
+  // 2. Everything in the current level-0 slot is due: move it to pending
+  uint16_t list = (uint16_t)(_now & TIMER_SLOT_MASK);
+  uint16_t i = _heads[list];
+  if (i == TIMER_NIL)
+    return;
+  _heads[list] = TIMER_NIL;
+  while (i != TIMER_NIL)
+  {
+    uint16_t next = _nodes[i].next;
+    link(i, TIMER_LIST_PENDING);
+    i = next;
+  }
+
+  // 3. Fire one at a time; callbacks may start / cancel / restart freely
+  while (_heads[TIMER_LIST_PENDING] != TIMER_NIL)
+  {
+    i = _heads[TIMER_LIST_PENDING];
+    TimerNode& n = _nodes[i];
+    Callback callback = n.callback; // The node may be reused by then
+
+    unlink(i);
+    if (n.periodic)
+    {
+      n.expires += n.interval;
+      insert(i);
+    }
+    else
+      release(i);
+
+    callback();
+  }
+}
+
+TimerHandle TimerWheelBase::start(const Callback& callback, unsigned long delay, unsigned long period) {
+  if (!_started)
+  {
+    _now = millis();
+    _started = true;
+  }
+  if (_free == TIMER_NIL)
+    return TIMER_NONE;
+
+  uint16_t i = _free;
+  TimerNode& n = _nodes[i];
+  _free = n.next;
+
+  n.callback = callback;
+  n.periodic = (period > 0);
+  n.interval = n.periodic ? period : delay;
+  n.expires = _now + ((delay < 1) ? 1 : delay);
+  insert(i);
+  _active++;
+  return ((TimerHandle)n.generation << 16) | i;
+}
+
+bool TimerWheelBase::cancel(TimerHandle handle) {
+  TimerNode* n = lookup(handle);
+  if (n == NULL)
+    return false;
+  uint16_t i = (uint16_t)(n - _nodes);
+  unlink(i);
+  release(i);
+  return true;
+}
+
+bool TimerWheelBase::restart(TimerHandle handle) {
+  TimerNode* n = lookup(handle);
+  if (n == NULL)
+    return false;
+  return restart(handle, n->interval);
+}
+
+bool TimerWheelBase::restart(TimerHandle handle, unsigned long delay) {
+  TimerNode* n = lookup(handle);
+  if (n == NULL)
+    return false;
+  uint16_t i = (uint16_t)(n - _nodes);
+  unlink(i);
+  if (!n->periodic)
+    n->interval = delay;
+  n->expires = _now + ((delay < 1) ? 1 : delay);
+  insert(i);
+  return true;
+}
+
+bool TimerWheelBase::isActive(TimerHandle handle) {
+  return lookup(handle) != NULL;
+}
+
+void TimerWheelBase::update(unsigned long now) {
+  uint32_t target = (uint32_t)now;
+  if (!_started)
+  {
+    _now = target;
+    _started = true;
+    return;
+  }
+
+  // Batch: every ms since the last update, nothing to walk if idle
+  while (_now != target && (int32_t)(target - _now) > 0)
+  {
+    if (_active == 0)
+    {
+      _now = target;
+      break;
+    }
+    step();
+  }
+}
+
+void TimerWheelBase::update() {
+  update(millis());
+}
+
+uint16_t TimerWheelBase::getActiveCount() const {
+  return _active;
+}
+
+uint16_t TimerWheelBase::getCapacity() const {
+  return _capacity;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file TimerWheel.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Hierarchical Timing Wheel for One-Shot and Periodic Timers.
+ * Start, cancel and restart are O(1); expiries are processed in one batch
+ * per tick. Timers live in a fixed pool and are addressed by handles that
+ * go stale when the timer ends, so no heap and no dangling pointers.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <Arduino.h>
+#include "TaskManager.h"
+
+// Slots per level = 2^TIMER_WHEEL_BITS, 4 levels
+#if defined(__AVR__)
+  #define TIMER_WHEEL_BITS 4 // 16 slots, 65 s before re-cascading
+#else
+  #define TIMER_WHEEL_BITS 6 // 64 slots, 4.6 h before re-cascading
+#endif
+#define TIMER_WHEEL_LEVELS 4
+#define TIMER_WHEEL_SLOTS  (1 << TIMER_WHEEL_BITS)
+#define TIMER_NONE         0 // Invalid handle
+
+// Generation (high 16 bits) + pool index (low 16 bits); 0 is never issued
+typedef uint32_t TimerHandle;
+
+/**
+ * @brief One pool entry. Linked into a wheel slot while armed.
+ */
+struct TimerNode {
+  uint32_t expires;     // Absolute wheel time (ms)
+  uint32_t interval;    // Delay of the last start / restart, period if periodic
+  Callback callback;
+  uint16_t next;
+  uint16_t prev;
+  uint16_t list;        // Slot the node is linked into, TIMER_LIST_FREE if not armed
+  uint16_t generation;
+  bool periodic;
+};
+
+/**
+ * @brief Pool-size-independent part of TimerWheel (the wheel itself).
+ *
+ * Level 0 slots are 1 ms apart, each higher level 2^TIMER_WHEEL_BITS
+ * times coarser. A timer goes into the level whose span covers its
+ * delay; when the wheel reaches a coarse slot, that slot's timers are
+ * re-inserted one level down ("cascade"). Each timer is cascaded at most
+ * TIMER_WHEEL_LEVELS - 1 times, so cost per timer is bounded regardless
+ * of how many are armed. Delays beyond the top level's span are parked
+ * in its farthest slot and re-inserted when it comes round.
+ *
+ * Slots are doubly linked lists of pool indices, so cancel() unlinks
+ * without searching. Expired timers move to a pending list and fire one
+ * at a time, so a callback may start, cancel or restart any timer,
+ * including itself.
+ */
+class TimerWheelBase {
+  protected:
+    TimerNode* _nodes;    // The derived class owns the storage
+    uint16_t _capacity;
+    uint16_t _free;       // Head of the free list (through next)
+    uint16_t _active;
+    uint16_t _heads[TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS + 1]; // + pending list
+    uint32_t _now;        // Last processed wheel time (ms)
+    bool _started;
+
+    TimerWheelBase(TimerNode* nodes, uint16_t capacity);
+
+    TimerNode* lookup(TimerHandle handle);
+    void link(uint16_t index, uint16_t list);
+    void unlink(uint16_t index);
+    void insert(uint16_t index);
+    void cascade(uint8_t level);
+    void release(uint16_t index);
+    void step();
+
+  public:
+    /**
+     * @brief Cancels every timer and empties the pool.
+     */
+    void clear();
+
+    /**
+     * @brief Arms a timer.
+     * @param callback Function, member function or lambda to call on expiry.
+     * @param delay Milliseconds until the first call (0 counts as 1).
+     * @param period 0 = one-shot, otherwise repeat every `period` ms.
+     * @return TimerHandle, or TIMER_NONE if the pool is full.
+     */
+    TimerHandle start(const Callback& callback, unsigned long delay, unsigned long period = 0);
+
+    /**
+     * @brief Stops a timer. Stale handles are ignored.
+     * @return true if the timer was armed.
+     */
+    bool cancel(TimerHandle handle);
+
+    /**
+     * @brief Re-arms a timer with its last delay from now (watchdog kick).
+     * @return false if the handle is stale (timer already fired or cancelled).
+     */
+    bool restart(TimerHandle handle);
+
+    /**
+     * @brief Re-arms a timer with a new delay from now.
+     */
+    bool restart(TimerHandle handle, unsigned long delay);
+
+    /**
+     * @brief True while the handle refers to an armed timer.
+     */
+    bool isActive(TimerHandle handle);
+
+    /**
+     * @brief Advances the wheel to `now` and fires every timer due.
+     * @param now Current time in ms (e.g. TickClock::ms()).
+     */
+    void update(unsigned long now);
+
+    /**
+     * @brief Same as update(now), reading millis().
+     */
+    void update();
+
+    uint16_t getActiveCount() const;
+    uint16_t getCapacity() const;
+};
+
+/**
+ * @brief Timing wheel with a pool of N timers.
+ *
+ * Usage Example:
+ * TimerWheel<8> timers;
+ * TimerHandle watchdog = timers.start(stopMotors, 200); // One-shot
+ * timers.start(blinkStatus, 500, 500);                  // Periodic
+ * // On every joystick packet: timers.restart(watchdog);
+ * // loop(): timers.update();
+ * @tparam N Pool size (max simultaneously armed timers, up to 65534).
+ */
+template <uint16_t N>
+class TimerWheel : public TimerWheelBase {
+  private:
+    TimerNode _pool[N];
+
+  public:
+    TimerWheel() : TimerWheelBase(_pool, N) {
+      clear();
+    }
+};
+
+#endif
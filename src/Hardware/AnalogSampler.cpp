@@ -0,0 +1,407 @@
+/**
+ * @file AnalogSampler.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of AnalogSampler class.
+ * @version 1.2.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "AnalogSampler.h"
+
+AnalogSampler::AnalogSampler() {
+  _count = 0;
+  _index = 0;
+  _converting = false;
+#if defined(__AVR__)
+  _reference = DEFAULT;
+#else
+  _reference = 0;
+#endif
+  _interval = 0;
+  _lastStart = 0;
+  _windowStart = 0;
+  _eventHead = 0;
+  _eventCount = 0;
+  _dropped = 0;
+  _handler = NULL;
+
+  int i;
+  i = 0;
+  while (i < ANALOG_MAX_WATCHERS)
+    _watchChannel[i++] = -1;
+}
+
+int AnalogSampler::addChannel(uint8_t pin, SignalFilter* filter) {
+  if (_count >= ANALOG_MAX_CHANNELS)
+    return -1;
+
+  #ifdef INPUT_ANALOG
+    pinMode(pin, INPUT_ANALOG);
+  #else
+    pinMode(pin, INPUT);
+  #endif
+
+  _pin[_count] = pin;
+  _filter[_count] = filter;
+  _raw[_count] = 0;
+  _value[_count] = 0;
+  _samples[_count] = 0;
+  _windowSamples[_count] = 0;
+  _rate[_count] = 0.0f;
+  _accum[_count] = 0;
+  _accumCount[_count] = 0;
+  _oversample[_count] = 0;
+  _count++;
+  return _count - 1;
+}
+
+void AnalogSampler::begin() {
+  _index = 0;
+  _converting = false;
+  _lastStart = micros() - _interval; // First conversion starts right away
+  _windowStart = micros();
+}
+
+void AnalogSampler::setInterval(unsigned long us) {
+  _interval = us;
+}
+
+void AnalogSampler::setReference(uint8_t mode) {
+  _reference = mode;
+}
+
+void AnalogSampler::setOversampling(int channel, uint8_t bits) {
+  if (channel < 0 || channel >= _count)
+    return;
+  if (bits > ANALOG_MAX_OVERSAMPLE)
+    bits = ANALOG_MAX_OVERSAMPLE;
+
+  // Keep the last result valid on the new scale until the first new one
+  if (bits >= _oversample[channel])
+  {
+    _raw[channel] <<= bits - _oversample[channel];
+    _value[channel] <<= bits - _oversample[channel];
+  }
+  else
+  {
+    _raw[channel] >>= _oversample[channel] - bits;
+    _value[channel] >>= _oversample[channel] - bits;
+  }
+  _oversample[channel] = bits;
+  _accum[channel] = 0;
+  _accumCount[channel] = 0;
+}
+
+/**
+ * @brief Classic AVR: selects the channel and sets ADSC, mirroring
+ * analogRead() without the busy-wait.
+ */
+void AnalogSampler::startConversion(uint8_t pin) {
+#if defined(ANALOG_SPLIT_PHASE)
+  // 1. Pin number to ADC channel (same mapping as wiring_analog.c)
+  #if defined(analogPinToChannel)
+    #if defined(__AVR_ATmega32U4__)
+      if (pin >= 18)
+        pin -= 18;
+    #endif
+    pin = analogPinToChannel(pin);
+  #elif defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+    if (pin >= 54)
+      pin -= 54;
+  #else
+    if (pin >= 14)
+      pin -= 14;
+  #endif
+
+  // 2. Mux (MUX5 lives in ADCSRB on the larger chips), then start
+  #if defined(ADCSRB) && defined(MUX5)
+    ADCSRB = (ADCSRB & ~(1 << MUX5)) | (((pin >> 3) & 0x01) << MUX5);
+  #endif
+  ADMUX = (_reference << 6) | (pin & 0x07);
+  ADCSRA |= (1 << ADSC);
+#else
+  (void)pin;
+#endif
+}
+
+/**
+ * @brief Files one result for the current channel and moves to the next.
+ */
+void AnalogSampler::store(int raw, unsigned long now) {
+  uint8_t ch = _index;
+  bool ready = true;
+
+  // 1. Oversampling: sum 4^n conversions, then shift right by n (rounded)
+  if (_oversample[ch] > 0)
+  {
+    _accum[ch] += (uint16_t)raw;
+    _accumCount[ch]++;
+    ready = (_accumCount[ch] >> (2 * _oversample[ch])) != 0;
+    if (ready)
+    {
+      raw = (int)((_accum[ch] + (1UL << (_oversample[ch] - 1))) >> _oversample[ch]);
+      _accum[ch] = 0;
+      _accumCount[ch] = 0;
+    }
+  }
+
+  // 2. Publish the result
+  if (ready)
+  {
+    _raw[ch] = raw;
+    if (_filter[ch] != NULL)
+      _value[ch] = _filter[ch]->filter(raw);
+    else
+      _value[ch] = raw;
+    _samples[ch]++;
+    if (_windowSamples[ch] < 0xFFFF)
+      _windowSamples[ch]++;
+    evaluate(ch, now);
+  }
+
+  // 3. Next channel
+  _index++;
+  if (_index < _count)
+    return;
+  _index = 0;
+
+  // End of a scan: close the rate window if it is due
+  unsigned long elapsed = now - _windowStart;
+  if (elapsed < ANALOG_RATE_WINDOW_US)
+    return;
+  int i;
+  i = 0;
+  while (i < _count)
+  {
+    _rate[i] = (float)_windowSamples[i] * 1000000.0f / (float)elapsed;
+    _windowSamples[i] = 0;
+    i++;
+  }
+  _windowStart = now;
+}
+
+void AnalogSampler::update() {
+  if (_count == 0)
+    return;
+  unsigned long now = micros();
+
+#if defined(ANALOG_SPLIT_PHASE)
+  // 1. Collect the conversion in flight, if the ADC is done with it
+  if (_converting)
+  {
+    if (ADCSRA & (1 << ADSC))
+      return; // Nothing new, so nothing new to dispatch either
+    uint8_t low = ADCL; // ADCL first: it locks ADCH until read
+    uint8_t high = ADCH;
+    _converting = false;
+    store((high << 8) | low, now);
+  }
+
+  // 2. Start the next one when the interval allows
+  if (now - _lastStart >= _interval)
+  {
+    _lastStart = now;
+    startConversion(_pin[_index]);
+    _converting = true;
+  }
+#else
+  if (now - _lastStart < _interval)
+    return;
+  _lastStart = now;
+  store(analogRead(_pin[_index]), now);
+#endif
+
+  if (_handler != NULL && _eventCount > 0)
+    dispatch();
+}
+
+uint8_t AnalogSampler::getResolution(int channel) const {
+  if (channel < 0 || channel >= _count)
+    return ANALOG_ADC_BITS;
+  return ANALOG_ADC_BITS + _oversample[channel];
+}
+
+long AnalogSampler::getMaxValue(int channel) const {
+  return (1L << getResolution(channel)) - 1;
+}
+
+int AnalogSampler::getRaw(int channel) const {
+  if (channel < 0 || channel >= _count)
+    return 0;
+  return _raw[channel];
+}
+
+int AnalogSampler::getValue(int channel) const {
+  if (channel < 0 || channel >= _count)
+    return 0;
+  return _value[channel];
+}
+
+float AnalogSampler::getSampleRate(int channel) const {
+  if (channel < 0 || channel >= _count)
+    return 0.0f;
+  return _rate[channel];
+}
+
+unsigned long AnalogSampler::getSampleCount(int channel) const {
+  if (channel < 0 || channel >= _count)
+    return 0;
+  return _samples[channel];
+}
+
+int AnalogSampler::getCount() const {
+  return _count;
+}
+
+// =============================================================================
+// WATCHERS
+// =============================================================================
+
+int AnalogSampler::addWatcher(int channel, uint8_t type, int low, int high, int hysteresis, bool filtered) {
+  if (channel < 0 || channel >= _count)
+    return -1;
+  int i;
+  i = 0;
+  while (i < ANALOG_MAX_WATCHERS && _watchChannel[i] >= 0)
+    i++;
+  if (i >= ANALOG_MAX_WATCHERS)
+    return -1;
+
+  _watchChannel[i] = (int8_t)channel;
+  _watchType[i] = type;
+  _watchFiltered[i] = filtered;
+  _watchLow[i] = low;
+  _watchHigh[i] = high;
+  _watchHyst[i] = hysteresis;
+  _watchState[i] = 2;
+  return i;
+}
+
+int AnalogSampler::addThreshold(int channel, int threshold, int hysteresis, bool filtered) {
+  return addWatcher(channel, ANALOG_EVENT_RISE, threshold, threshold, hysteresis, filtered);
+}
+
+int AnalogSampler::addWindow(int channel, int low, int high, int hysteresis, bool filtered) {
+  return addWatcher(channel, ANALOG_EVENT_ENTER, low, high, hysteresis, filtered);
+}
+
+void AnalogSampler::setThreshold(int watcher, int threshold, int hysteresis) {
+  if (watcher < 0 || watcher >= ANALOG_MAX_WATCHERS || _watchChannel[watcher] < 0)
+    return;
+  _watchLow[watcher] = threshold;
+  _watchHigh[watcher] = threshold;
+  _watchHyst[watcher] = hysteresis;
+}
+
+void AnalogSampler::removeWatcher(int watcher) {
+  if (watcher >= 0 && watcher < ANALOG_MAX_WATCHERS)
+    _watchChannel[watcher] = -1;
+}
+
+bool AnalogSampler::isAbove(int watcher) const {
+  if (watcher < 0 || watcher >= ANALOG_MAX_WATCHERS || _watchChannel[watcher] < 0)
+    return false;
+  return _watchState[watcher] == 1;
+}
+
+/**
+ * @brief Runs every watcher of a channel against its newest result.
+ * The first result only sets the state; later ones queue transitions.
+ */
+void AnalogSampler::evaluate(uint8_t channel, unsigned long now) {
+  int i;
+  i = 0;
+  while (i < ANALOG_MAX_WATCHERS)
+  {
+    if (_watchChannel[i] != (int8_t)channel)
+    {
+      i++;
+      continue;
+    }
+    int v = _watchFiltered[i] ? _value[channel] : _raw[channel];
+    int h = _watchHyst[i];
+    uint8_t state = _watchState[i];
+
+    // 1. New side (hysteresis band keeps the old one)
+    if (_watchType[i] == ANALOG_EVENT_RISE)
+    {
+      if (v > _watchHigh[i] + h)
+        state = 1;
+      else if (v < _watchLow[i] - h)
+        state = 0;
+      else if (state == 2)
+        state = (v >= _watchHigh[i]) ? 1 : 0;
+    }
+    else
+    {
+      if (v >= _watchLow[i] + h && v <= _watchHigh[i] - h)
+        state = 1;
+      else if (v < _watchLow[i] - h || v > _watchHigh[i] + h)
+        state = 0;
+      else if (state == 2)
+        state = (v >= _watchLow[i] && v <= _watchHigh[i]) ? 1 : 0;
+    }
+
+    // 2. Queue the transition
+    if (_watchState[i] != 2 && state != _watchState[i])
+    {
+      uint8_t type = _watchType[i]; // RISE or ENTER
+      if (state == 0)
+        type++;                     // FALL or EXIT
+      pushEvent(i, type, v, now);
+    }
+    _watchState[i] = state;
+    i++;
+  }
+}
+
+void AnalogSampler::pushEvent(uint8_t watcher, uint8_t type, int value, unsigned long now) {
+  if (_eventCount >= ANALOG_EVENT_QUEUE)
+  {
+    _dropped++;
+    return;
+  }
+  AnalogEvent& e = _events[(_eventHead + _eventCount) % ANALOG_EVENT_QUEUE];
+  e.watcher = watcher;
+  e.channel = (uint8_t)_watchChannel[watcher];
+  e.type = type;
+  e.value = value;
+  e.time = now;
+  _eventCount++;
+}
+
+void AnalogSampler::setEventHandler(AnalogEventHandler handler) {
+  _handler = handler;
+}
+
+bool AnalogSampler::popEvent(AnalogEvent& event) {
+  if (_eventCount == 0)
+    return false;
+  event = _events[_eventHead];
+  _eventHead = (_eventHead + 1) % ANALOG_EVENT_QUEUE;
+  _eventCount--;
+  return true;
+}
+
+int AnalogSampler::dispatch() {
+  AnalogEvent event;
+  int handled = 0;
+  if (_handler == NULL)
+    return 0;
+  while (popEvent(event))
+  {
+    _handler(event);
+    handled++;
+  }
+  return handled;
+}
+
+unsigned long AnalogSampler::getDroppedEvents() const {
+  return _dropped;
+}
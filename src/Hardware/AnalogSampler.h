@@ -0,0 +1,287 @@
+/**
+ * @file AnalogSampler.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Background ADC Sampling Engine.
+ * Scans registered analog channels round-robin from update() and keeps
+ * the latest raw and filtered value of each, so readers never wait for
+ * a conversion.
+ * @version 1.2.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef ANALOG_SAMPLER_H
+#define ANALOG_SAMPLER_H
+
+#include <Arduino.h>
+#include "../Utils/SignalFilter.h"
+
+#define ANALOG_MAX_CHANNELS   8       // Channels per sampler
+#define ANALOG_RATE_WINDOW_US 1000000 // Sample-rate measurement window
+
+// Native ADC resolution (bits) of analogRead()
+#if defined(__STM32F1__) || defined(ARDUINO_ARCH_STM32) || defined(OPENCM904)
+  #define ANALOG_ADC_BITS 12
+#else
+  #define ANALOG_ADC_BITS 10
+#endif
+
+#define ANALOG_MAX_WATCHERS 8  // Threshold / window watchers per sampler
+#define ANALOG_EVENT_QUEUE  16 // Pending events (oldest kept, newest dropped)
+
+// Event types
+#define ANALOG_EVENT_RISE  0 // Threshold: crossed up
+#define ANALOG_EVENT_FALL  1 // Threshold: crossed down
+#define ANALOG_EVENT_ENTER 2 // Window: came inside
+#define ANALOG_EVENT_EXIT  3 // Window: left
+
+// Split-phase conversions need the classic AVR ADC registers; megaAVR
+// (Nano Every, ATmega4809) has ADC0.* instead and uses analogRead()
+#if defined(__AVR__) && defined(ADCSRA) && defined(ADMUX)
+  #define ANALOG_SPLIT_PHASE
+#endif
+
+// Extra bits available by oversampling (results must still fit an int)
+#if defined(__AVR__)
+  #define ANALOG_MAX_OVERSAMPLE 5
+#else
+  #define ANALOG_MAX_OVERSAMPLE 6
+#endif
+
+/**
+ * @brief One watcher transition, stamped when the sample was taken.
+ */
+struct AnalogEvent {
+  uint8_t watcher;      // Id returned by addThreshold() / addWindow()
+  uint8_t channel;
+  uint8_t type;         // ANALOG_EVENT_*
+  int value;            // Sample that caused it
+  unsigned long time;   // micros() of that sample
+};
+
+typedef void (*AnalogEventHandler)(const AnalogEvent& event);
+
+/**
+ * @brief Round-robin sampler for up to ANALOG_MAX_CHANNELS analog pins.
+ *
+ * On classic AVR (ADCSRA / ADMUX: Uno, Nano, Mega, Leonardo) each
+ * conversion is split in two phases: update() starts it by writing the
+ * ADC registers and returns at once; a later update() picks up the result
+ * when the ADC is done (~104 us at the default prescaler) and starts the
+ * next channel. No call ever waits for the ADC.
+ * Other cores, megaAVR (Nano Every) included, convert one channel per
+ * update() with analogRead(): a few microseconds on 32-bit cores, a full
+ * blocking conversion on megaAVR.
+ *
+ * Each result is pushed through the channel's SignalFilter (if any) in
+ * update(), so the filter sees a fixed sample rate no matter how often
+ * the value is read. getValue() and getRaw() are plain array reads.
+ *
+ * Oversampling (setOversampling()): a channel can sum 4^n conversions
+ * and shift the sum right by n, giving n extra bits. This only works if
+ * the input carries at least ~1 LSB of noise (dither); a perfectly
+ * steady input just gives the same code with n zeros appended.
+ *
+ * Watchers (addThreshold(), addWindow()) work like a comparator: they
+ * are evaluated in update() on every new result of their channel, and
+ * each transition is queued as a timestamped AnalogEvent. dispatch()
+ * hands the queue to the event handler (update() does this itself once
+ * a handler is set), or popEvent() drains it by polling. Reaction time
+ * is one channel period, not the caller's polling period.
+ *
+ * With split-phase conversions do not call analogRead() on other pins
+ * while the sampler is running: both use the same ADC. Attach every
+ * analog sensor instead.
+ *
+ * Usage Example:
+ * AnalogSampler adc;
+ * SmartAnalog ldr(A0);
+ * ldr.begin();
+ * ldr.attach(adc);            // ldr.readSmooth() no longer blocks
+ * int pot = adc.addChannel(A1);
+ * adc.begin();
+ * // loop(): adc.update(); ... adc.getValue(pot);
+ */
+class AnalogSampler {
+  private:
+    uint8_t _pin[ANALOG_MAX_CHANNELS];
+    SignalFilter* _filter[ANALOG_MAX_CHANNELS];
+    int _raw[ANALOG_MAX_CHANNELS];             // Latest conversion
+    int _value[ANALOG_MAX_CHANNELS];           // Latest filtered value
+    unsigned long _samples[ANALOG_MAX_CHANNELS];
+    uint16_t _windowSamples[ANALOG_MAX_CHANNELS];
+    float _rate[ANALOG_MAX_CHANNELS];          // Samples/s over the last window
+    uint32_t _accum[ANALOG_MAX_CHANNELS];      // Oversampling sum
+    uint16_t _accumCount[ANALOG_MAX_CHANNELS];
+    uint8_t _oversample[ANALOG_MAX_CHANNELS];  // Extra bits (0 = off)
+    int _count;
+    uint8_t _index;             // Channel being (or next to be) converted
+    bool _converting;           // AVR: a conversion is in flight
+    uint8_t _reference;         // AVR: REFS bits (must match analogReference())
+    unsigned long _interval;    // Min us between conversion starts
+    unsigned long _lastStart;
+    unsigned long _windowStart;
+
+    // --- Watchers ---
+    int8_t _watchChannel[ANALOG_MAX_WATCHERS]; // -1 = free slot
+    uint8_t _watchType[ANALOG_MAX_WATCHERS];   // Threshold or window
+    bool _watchFiltered[ANALOG_MAX_WATCHERS];  // Compare filtered value, not raw
+    int _watchLow[ANALOG_MAX_WATCHERS];
+    int _watchHigh[ANALOG_MAX_WATCHERS];
+    int _watchHyst[ANALOG_MAX_WATCHERS];
+    uint8_t _watchState[ANALOG_MAX_WATCHERS];  // 0 / 1, or 2 before the first sample
+
+    // --- Event queue ---
+    AnalogEvent _events[ANALOG_EVENT_QUEUE];
+    uint8_t _eventHead;
+    uint8_t _eventCount;
+    unsigned long _dropped;
+    AnalogEventHandler _handler;
+
+    void startConversion(uint8_t pin);
+    int addWatcher(int channel, uint8_t type, int low, int high, int hysteresis, bool filtered);
+    void evaluate(uint8_t channel, unsigned long now);
+    void pushEvent(uint8_t watcher, uint8_t type, int value, unsigned long now);
+    void store(int raw, unsigned long now);
+
+  public:
+    AnalogSampler();
+
+    /**
+     * @brief Registers an analog pin.
+     * @param pin Analog pin (A0, A1, etc.).
+     * @param filter Optional filter fed with every sample (not owned;
+     * its begin() must have been called).
+     * @return int Channel index, or -1 if the sampler is full.
+     */
+    int addChannel(uint8_t pin, SignalFilter* filter = NULL);
+
+    /**
+     * @brief Resets the scan and the rate window. Call after adding channels.
+     */
+    void begin();
+
+    /**
+     * @brief Heartbeat. Call frequently from loop().
+     * Collects a finished conversion and/or starts the next one.
+     */
+    void update();
+
+    /**
+     * @brief Minimum time between two conversions (Default: 0 = back to back).
+     * Each channel is then sampled every interval * channel count.
+     */
+    void setInterval(unsigned long us);
+
+    /**
+     * @brief Classic AVR only: ADC reference to use (DEFAULT, INTERNAL,
+     * EXTERNAL). Must match analogReference(); the sampler writes ADMUX
+     * itself. Ignored elsewhere (analogRead() applies the reference).
+     */
+    void setReference(uint8_t mode);
+
+    /**
+     * @brief Oversamples a channel: 4^bits conversions per result,
+     * decimated to ANALOG_ADC_BITS + bits bits. The channel's result rate
+     * drops by the same 4^bits.
+     * @param bits Extra bits, 0 (off) to ANALOG_MAX_OVERSAMPLE.
+     */
+    void setOversampling(int channel, uint8_t bits);
+
+    /**
+     * @brief Resolution of a channel's results in bits.
+     */
+    uint8_t getResolution(int channel) const;
+
+    /**
+     * @brief Full-scale value of a channel's results (2^bits - 1).
+     */
+    long getMaxValue(int channel) const;
+
+    /**
+     * @brief Latest unfiltered (decimated) result of a channel (0 before the first).
+     */
+    int getRaw(int channel) const;
+
+    /**
+     * @brief Latest filtered value of a channel (raw if it has no filter).
+     */
+    int getValue(int channel) const;
+
+    /**
+     * @brief Measured results per second of a channel over the last window
+     * (conversions / 4^bits when oversampling).
+     */
+    float getSampleRate(int channel) const;
+
+    /**
+     * @brief Total results produced on a channel.
+     */
+    unsigned long getSampleCount(int channel) const;
+
+    /**
+     * @brief Number of registered channels.
+     */
+    int getCount() const;
+
+    /**
+     * @brief Watches a channel for threshold crossings (Schmitt trigger).
+     * RISE when the value goes above threshold + hysteresis, FALL when it
+     * goes below threshold - hysteresis.
+     * @param filtered Compare the filtered value instead of the raw result
+     * (smoother, but delayed by the filter).
+     * @return int Watcher id, or -1 if none is free.
+     */
+    int addThreshold(int channel, int threshold, int hysteresis = 0, bool filtered = false);
+
+    /**
+     * @brief Watches a channel for entering / leaving [low, high].
+     * @return int Watcher id, or -1 if none is free.
+     */
+    int addWindow(int channel, int low, int high, int hysteresis = 0, bool filtered = false);
+
+    /**
+     * @brief Moves an existing threshold watcher (state is kept).
+     */
+    void setThreshold(int watcher, int threshold, int hysteresis = 0);
+
+    /**
+     * @brief Frees a watcher slot.
+     */
+    void removeWatcher(int watcher);
+
+    /**
+     * @brief Current side of a watcher: above the threshold / inside the
+     * window. False until the channel has been sampled once.
+     */
+    bool isAbove(int watcher) const;
+
+    /**
+     * @brief Handler for queued events; update() dispatches automatically.
+     */
+    void setEventHandler(AnalogEventHandler handler);
+
+    /**
+     * @brief Calls the handler for every queued event, oldest first.
+     * @return int Number of events handled.
+     */
+    int dispatch();
+
+    /**
+     * @brief Takes the oldest queued event (for use without a handler).
+     * @return true if there was one.
+     */
+    bool popEvent(AnalogEvent& event);
+
+    /**
+     * @brief Events lost because the queue was full.
+     */
+    unsigned long getDroppedEvents() const;
+};
+
+#endif
@@ -2,8 +2,8 @@
  * @file AsyncSonar.cpp
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief Implementation of AsyncSonar class.
- * @version 1.0.0
- * @date 2025-12-30
+ * @version 1.2.0
+ * @date 2026-10-18
  *
  * @copyright Copyright (c) 2025 Furkan
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -14,21 +14,71 @@
 
 #include "AsyncSonar.h"
 
+// HC-SR04 sends its 8-cycle burst before raising Echo (~0.5 ms); allow
+// this much from the end of the trigger to the rising edge.
+#define SONAR_RISE_TIMEOUT 2000UL
+
+AsyncSonar* AsyncSonar::_instances[SONAR_MAX_INTERRUPTS] = {NULL};
+
+// attachInterrupt() takes a plain function, so each slot gets a trampoline
+void AsyncSonar::isr0() { _instances[0]->handleEcho(); }
+void AsyncSonar::isr1() { _instances[1]->handleEcho(); }
+void AsyncSonar::isr2() { _instances[2]->handleEcho(); }
+void AsyncSonar::isr3() { _instances[3]->handleEcho(); }
+void AsyncSonar::isr4() { _instances[4]->handleEcho(); }
+void AsyncSonar::isr5() { _instances[5]->handleEcho(); }
+void AsyncSonar::isr6() { _instances[6]->handleEcho(); }
+void AsyncSonar::isr7() { _instances[7]->handleEcho(); }
+
 /**
  * @brief Constructor. Sets pins and default timeout (~400cm range).
  */
-AsyncSonar::AsyncSonar(int trigPin, int echoPin) {
+AsyncSonar::AsyncSonar(int trigPin, int echoPin) : _trig(trigPin), _echo(echoPin) {
   _trigPin = trigPin;
   _echoPin = echoPin;
   _state = SONAR_STATE_IDLE;
+  _timer = 0;
   _distance = 0.0;
   _timeout = 24000; // ~4 meters max distance timeout in microseconds
+  _status = SONAR_STATUS_NONE;
+  _duration = 0;
+  _speed = 0.0343; // cm/us at ~20 C
+
+  _slot = -1;
+  _rise = 0;
+  _fall = 0;
+  _edges = 0;
 }
 
 void AsyncSonar::begin() {
+  static void (*const trampolines[SONAR_MAX_INTERRUPTS])() = {isr0, isr1, isr2, isr3,
+                                                              isr4, isr5, isr6, isr7};
   pinMode(_trigPin, OUTPUT);
   pinMode(_echoPin, INPUT);
-  digitalWrite(_trigPin, LOW); // Ensure trigger is low initially
+  _trig.low(); // Ensure trigger is low initially
+
+  int irq = digitalPinToInterrupt(_echoPin);
+  if (_slot >= 0 || irq == NOT_AN_INTERRUPT)
+    return; // Already attached, or pulseIn() fallback
+
+  int i = 0;
+  while (i < SONAR_MAX_INTERRUPTS && _instances[i] != NULL)
+    i++;
+  if (i == SONAR_MAX_INTERRUPTS)
+    return;
+
+  _slot = i;
+  _instances[i] = this;
+  attachInterrupt(irq, trampolines[i], CHANGE);
+}
+
+void AsyncSonar::end() {
+  if (_slot < 0)
+    return;
+  detachInterrupt(digitalPinToInterrupt(_echoPin));
+  _instances[_slot] = NULL;
+  _slot = -1;
+  _state = SONAR_STATE_IDLE;
 }
 
 void AsyncSonar::startMeasure() {
@@ -40,6 +90,46 @@ void AsyncSonar::startMeasure() {
   }
 }
 
+/**
+ * @brief Echo ISR: timestamp both edges of one pulse, ignore the rest.
+ */
+void AsyncSonar::handleEcho() {
+  unsigned long now = micros();
+
+  if (_state != SONAR_STATE_WAIT_ECHO || _edges >= 2)
+    return;
+  if (_echo.read() == HIGH)
+  {
+    _rise = now;
+    _edges = 1;
+  }
+  else if (_edges == 1)
+  {
+    _fall = now;
+    _edges = 2;
+  }
+}
+
+/**
+ * @brief Ends a measurement. duration == 0 means timeout.
+ */
+void AsyncSonar::finish(unsigned long duration) {
+  if (duration > 0) 
+  {
+    // Speed of sound: 343m/s or 0.0343 cm/us (see setTemperature)
+    // Distance = (Time * Speed) / 2
+    _duration = duration;
+    _distance = (float)duration * _speed / 2.0;
+    _status = SONAR_STATUS_OK;
+  } 
+  else 
+  {
+    // Keep the last valid distance (safer for robots), but say so
+    _status = SONAR_STATUS_TIMEOUT;
+  }
+  _state = SONAR_STATE_IDLE; // Measurement done, go back to IDLE
+}
+
 /**
  * @brief State Machine logic.
  * 1. Ensure Low (2us) -> 2. Trigger High (10us) -> 3. Wait Echo
@@ -50,10 +140,10 @@ void AsyncSonar::update() {
   switch (_state) {
     case SONAR_STATE_TRIG_LOW:
       // Step 1: Hold Trig LOW for at least 2us
-      digitalWrite(_trigPin, LOW);
+      _trig.low();
       if (currentMicros - _timer >= 2) 
       {
-        digitalWrite(_trigPin, HIGH);
+        _trig.high();
         _timer = currentMicros;
         _state = SONAR_STATE_TRIG_HIGH;
       }
@@ -63,38 +153,64 @@ void AsyncSonar::update() {
       // Step 2: Hold Trig HIGH for at least 10us
       if (currentMicros - _timer >= 10) 
       {
-        digitalWrite(_trigPin, LOW);
-        _state = SONAR_STATE_WAIT_ECHO;
+        _edges = 0;
+        _timer = currentMicros;
+        _state = SONAR_STATE_WAIT_ECHO; // Armed before the echo can rise
+        _trig.low();
       }
       break;
 
     case SONAR_STATE_WAIT_ECHO:
       // Step 3: Read Echo Pulse
-      // Note: pulseIn() is technically blocking, but we use a timeout.
-      // For a purely non-blocking approach, pin change interrupts would be required,
-      // which reduces portability across different Arduino boards.
-      // This hybrid approach is safe for most loops.
-      
-      long duration = pulseIn(_echoPin, HIGH, _timeout);
-      
-      if (duration > 0) 
+      if (_slot >= 0)
       {
-        // Speed of sound: 343m/s or 0.0343 cm/us
-        // Distance = (Time * Speed) / 2
-        _distance = (float)duration * 0.0343 / 2.0;
-      } 
-      else 
+        // Interrupt path: O(1) check, never waits
+        noInterrupts();
+        uint8_t edges = _edges;
+        unsigned long rise = _rise;
+        unsigned long fall = _fall;
+        interrupts();
+
+        if (edges == 2)
+          finish((fall - rise <= _timeout) ? fall - rise : 0);
+        else if (edges == 1 && currentMicros - rise > _timeout)
+          finish(0); // Pulse longer than the range limit
+        else if (edges == 0 && currentMicros - _timer > SONAR_RISE_TIMEOUT)
+          finish(0); // Sensor never answered
+      }
+      else
       {
-        // If 0, it means timeout (out of range or error)
-        // We can keep the last valid distance or set to -1.
-        // Keeping last valid distance is usually safer for robots.
+        // Fallback: pulseIn() blocks for up to _timeout
+        finish(pulseIn(_echoPin, HIGH, _timeout));
       }
-      
-      _state = SONAR_STATE_IDLE; // Measurement done, go back to IDLE
       break;
   }
 }
 
 float AsyncSonar::getDistance() {
   return _distance;
-}
\ No newline at end of file
+}
+
+int AsyncSonar::getStatus() {
+  return _status;
+}
+
+bool AsyncSonar::isBusy() {
+  return _state != SONAR_STATE_IDLE;
+}
+
+bool AsyncSonar::isInterruptDriven() {
+  return _slot >= 0;
+}
+
+void AsyncSonar::setTimeout(unsigned long us) {
+  _timeout = us;
+}
+
+void AsyncSonar::setTemperature(float celsius) {
+  _speed = (331.3 + 0.606 * celsius) / 10000.0;
+}
+
+unsigned long AsyncSonar::getDuration() {
+  return _duration;
+}
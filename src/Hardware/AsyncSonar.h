@@ -2,9 +2,10 @@
  * @file AsyncSonar.h
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief Non-blocking Ultrasonic Sensor Driver (HC-SR04).
- * Uses a State Machine to handle trigger pulses without delay().
- * @version 1.0.0
- * @date 2025-12-30
+ * Uses a State Machine to handle trigger pulses without delay(), and
+ * captures the echo with a pin interrupt so update() never waits.
+ * @version 1.2.1
+ * @date 2026-10-18
  *
  * @copyright Copyright (c) 2025 Furkan
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,6 +18,7 @@
 #define ASYNC_SONAR_H
 
 #include <Arduino.h>
+#include "FastPin.h"
 
 // =============================================================================
 // STATE DEFINITIONS
@@ -26,18 +28,64 @@
 #define SONAR_STATE_TRIG_HIGH  2
 #define SONAR_STATE_WAIT_ECHO  3
 
+// =============================================================================
+// STATUS DEFINITIONS (result of the last measurement)
+// =============================================================================
+#define SONAR_STATUS_NONE      0 // No measurement finished yet
+#define SONAR_STATUS_OK        1 // getDistance() holds this measurement
+#define SONAR_STATUS_TIMEOUT   2 // No echo in time (out of range / no sensor)
+
+#define SONAR_MAX_INTERRUPTS   8 // Sonars that can use the interrupt path
+
 /**
  * @brief Driver class for HC-SR04 Ultrasonic Sensors.
  * Implements a non-blocking state machine for the Trigger phase.
+ *
+ * Echo capture: if the echo pin supports attachInterrupt() (and one of the
+ * SONAR_MAX_INTERRUPTS slots is free), a CHANGE interrupt timestamps the
+ * rising and falling edges and update() only checks a flag: O(1), no
+ * waiting. Otherwise update() falls back to pulseIn(), which blocks for
+ * up to the timeout.
+ *
+ * Only external interrupts are used (no pin-change interrupts). On an
+ * Uno / Nano (ATmega328P) that is pins 2 and 3 only, on a Mega 2, 3, 18,
+ * 19, 20 and 21; echo wires on other pins take the blocking pulseIn()
+ * path (up to 24 ms per ping by default). ESP32, SAMD, STM32 / OpenCM
+ * and megaAVR (Nano Every) boards can interrupt on any pin. Check
+ * isInterruptDriven() after begin().
  */
 class AsyncSonar {
   private:
     int _trigPin;
     int _echoPin;
-    int _state;             // Current state of the machine
+    FastPin _trig;                  // Register access for the state machine
+    FastPin _echo;                  // and the echo ISR
+    volatile uint8_t _state; // Current state of the machine (read by the echo ISR)
     unsigned long _timer;   // To track microsecond timings
     float _distance;        // Last calculated distance in cm
     unsigned long _timeout; // Max wait time for echo
+    int _status;            // SONAR_STATUS_* of the last measurement
+    unsigned long _duration; // Last valid echo width in us
+    float _speed;           // Speed of sound in cm/us
+
+    // --- Interrupt echo capture ---
+    int _slot;                      // Interrupt slot (-1 = pulseIn fallback)
+    volatile unsigned long _rise;   // micros() at echo rising edge
+    volatile unsigned long _fall;   // micros() at echo falling edge
+    volatile uint8_t _edges;        // 0 = waiting, 1 = rose, 2 = complete
+
+    static AsyncSonar* _instances[SONAR_MAX_INTERRUPTS];
+    static void isr0();
+    static void isr1();
+    static void isr2();
+    static void isr3();
+    static void isr4();
+    static void isr5();
+    static void isr6();
+    static void isr7();
+
+    void handleEcho();
+    void finish(unsigned long duration);
 
   public:
     /**
@@ -49,8 +97,14 @@ class AsyncSonar {
 
     /**
      * @brief Initializes the pins.
+     * Attaches the echo interrupt when the pin supports it.
      */
     void begin();
+
+    /**
+     * @brief Detaches the echo interrupt and frees its slot.
+     */
+    void end();
     
     /**
      * @brief Manually starts a new measurement sequence.
@@ -67,9 +121,42 @@ class AsyncSonar {
     
     /**
      * @brief Returns the last measured distance.
+     * After a timeout the last valid distance is kept; check getStatus().
      * @return float Distance in centimeters (cm).
      */
     float getDistance();
+
+    /**
+     * @brief Result of the last finished measurement (SONAR_STATUS_*).
+     */
+    int getStatus();
+
+    /**
+     * @brief True while a measurement is in progress.
+     */
+    bool isBusy();
+
+    /**
+     * @brief True if the echo is captured by interrupt (non-blocking path).
+     */
+    bool isInterruptDriven();
+
+    /**
+     * @brief Sets the max echo pulse width (Default: 24000 us, ~4 m).
+     */
+    void setTimeout(unsigned long us);
+
+    /**
+     * @brief Air temperature for the speed of sound: c = 331.3 + 0.606 * T m/s.
+     * Default 0.0343 cm/us (~20 C). 0 C vs 35 C is a 6% range difference.
+     * @param celsius Air temperature.
+     */
+    void setTemperature(float celsius);
+
+    /**
+     * @brief Last valid echo pulse width in microseconds (round trip).
+     */
+    unsigned long getDuration();
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -2,8 +2,8 @@
  * @file BatteryMonitor.cpp
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief Implementation of BatteryMonitor class.
- * @version 1.0.0
- * @date 2025-12-30
+ * @version 1.3.0
+ * @date 2026-10-18
  *
  * @copyright Copyright (c) 2025 Furkan
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -14,6 +14,14 @@
 
 #include "BatteryMonitor.h"
 
+// Resting cell voltage (mV) at 0%, 10%, ... 100% state of charge
+static const uint16_t LIPO_CURVE[11] PROGMEM = {
+  3270, 3690, 3750, 3790, 3830, 3870, 3920, 3970, 4030, 4110, 4200
+};
+static const uint16_t NIMH_CURVE[11] PROGMEM = {
+  1000, 1100, 1180, 1210, 1230, 1250, 1270, 1290, 1320, 1360, 1420
+};
+
 /**
  * @brief Constructor. Allocates memory for the noise filter.
  */
@@ -21,18 +29,28 @@ BatteryMonitor::BatteryMonitor(int pin, float ratio, float refVoltage) {
   _pin = pin;
   _voltageDividerRatio = ratio;
   _refVoltage = refVoltage;
-  
-  // OpenCM9.04 (STM32) has 12-bit ADC (0-4095). 
+  _sampler = NULL;
+  _channel = -1;
+  _minMillivolts = 0;
+  _maxMillivolts = 1000;
+  _chemistry = BATTERY_LINEAR;
+  _cells = 1;
+  _rInternal = 0;
+  _loadCurrent = 0;
+  _interval = 100;
+  _lastUpdate = 0;
+  _millivolts = 0;
+  _restMillivolts = 0;
+  _percentage = 0;
+
+  // OpenCM9.04 (STM32) has 12-bit ADC (0-4095).
   // Standard Arduino has 10-bit (0-1023).
-  // Detecting architecture for resolution:
-  #if defined(__STM32F1__) || defined(ARDUINO_ARCH_STM32)
-    _adcResolution = 4095;
-  #else
-    _adcResolution = 1023;
-  #endif
+  _adcResolution = (1L << ANALOG_ADC_BITS) - 1;
+  updateScale();
 
-  // Create a filter with window size 20 (Smooth readings)
-  _filter = new SignalFilter(20);
+  // Create filters with window size 20 (Smooth readings)
+  _filter = new SignalFilter(BATTERY_FILTER_SIZE);
+  _currentFilter = new SignalFilter(BATTERY_FILTER_SIZE);
 }
 
 /**
@@ -41,51 +59,178 @@ BatteryMonitor::BatteryMonitor(int pin, float ratio, float refVoltage) {
 BatteryMonitor::~BatteryMonitor() {
   if (_filter != NULL)
     delete _filter;
+  if (_currentFilter != NULL)
+    delete _currentFilter;
 }
 
 void BatteryMonitor::begin(float minV, float maxV) {
-  pinMode(_pin, INPUT_ANALOG);
-  _minVoltage = minV;
-  _maxVoltage = maxV;
-  
-  if (_filter != NULL) 
+  #ifdef INPUT_ANALOG
+    pinMode(_pin, INPUT_ANALOG);
+  #else
+    pinMode(_pin, INPUT);
+  #endif
+  _minMillivolts = (long)(minV * 1000.0);
+  _maxMillivolts = (long)(maxV * 1000.0);
+  if (_maxMillivolts <= _minMillivolts)
+    _maxMillivolts = _minMillivolts + 1;
+
+  if (_filter != NULL)
     _filter->begin();
+  if (_currentFilter != NULL)
+    _currentFilter->begin();
+
+  // Prime both averages so the first cached values are already right
+  if (_filter != NULL)
+    _filter->fill(readAdc());
+  if (_currentFilter != NULL)
+    _currentFilter->fill(_loadCurrent);
+  sample();
+  _lastUpdate = millis();
+}
+
+bool BatteryMonitor::attach(AnalogSampler& sampler) {
+  // Raw channel: this monitor filters on its own schedule
+  int channel = sampler.addChannel(_pin);
+  if (channel < 0)
+    return false;
+  _sampler = &sampler;
+  _channel = channel;
+  return true;
+}
+
+bool BatteryMonitor::setOversampling(uint8_t bits) {
+  if (_sampler == NULL)
+    return false;
+  _sampler->setOversampling(_channel, bits);
+  _adcResolution = _sampler->getMaxValue(_channel);
+  updateScale();
+  if (_filter != NULL)
+    _filter->fill(_sampler->getRaw(_channel)); // Old samples are on the old scale
+  return true;
+}
+
+/**
+ * @brief Folds Vref, divider ratio and full scale into one factor, so a
+ * sample converts with a single integer multiply.
+ * Stays in 32 bits for a full scale (Vref * ratio) up to 65 V.
+ */
+void BatteryMonitor::updateScale() {
+  float fullScale = _refVoltage * _voltageDividerRatio * 1000.0; // mV
+  _scale = (uint32_t)(fullScale * 65536.0 / (float)_adcResolution + 0.5);
+}
+
+void BatteryMonitor::setUpdateInterval(unsigned long ms) {
+  _interval = ms;
+}
+
+void BatteryMonitor::setChemistry(uint8_t chemistry, uint8_t cells) {
+  _chemistry = chemistry;
+  _cells = (cells == 0) ? 1 : cells;
+  _percentage = percentageOf(_restMillivolts);
+}
+
+void BatteryMonitor::setInternalResistance(float ohms) {
+  _rInternal = (long)(ohms * 1000.0 + 0.5);
+}
+
+void BatteryMonitor::setLoadCurrent(float amps) {
+  _loadCurrent = (int)(amps * 1000.0);
 }
 
-float BatteryMonitor::getVoltage() {
-  int raw = analogRead(_pin);
-  
-  // Use SignalFilter to remove noise
+int BatteryMonitor::readAdc() {
+  if (_sampler != NULL)
+    return _sampler->getRaw(_channel);
+  return analogRead(_pin);
+}
+
+void BatteryMonitor::update() {
+  unsigned long now = millis();
+  if (now - _lastUpdate < _interval)
+    return;
+  _lastUpdate = now;
+  sample();
+}
+
+/**
+ * @brief Takes one sample into the filters and refreshes the cache.
+ */
+void BatteryMonitor::sample() {
+  // 1. Use SignalFilter to remove noise
+  int raw = readAdc();
   int smoothRaw = 0;
-  if (_filter != NULL) 
+  if (_filter != NULL)
     smoothRaw = _filter->filter(raw);
   else
     smoothRaw = raw; // Fallback if filter fails
-  
-  // Calculate Pin Voltage: (ADC / Resolution) * Vref
-  float pinVoltage = ((float)smoothRaw / (float)_adcResolution) * _refVoltage;
-  
-  // Calculate Real Battery Voltage: PinVoltage * DividerRatio
-  return pinVoltage * _voltageDividerRatio;
-}
-
-int BatteryMonitor::getPercentage() {
-  float voltage = getVoltage();
-  
-  // Linear mapping calculation
-  // (Current - Min) * 100 / (Max - Min)
-  int pct = (int)((voltage - _minVoltage) * 100.0 / (_maxVoltage - _minVoltage));
-  
-  // Clamp results between 0 and 100
-  if (pct > 100) 
-    return 100;
-  if (pct < 0) 
+
+  long currentMa = _loadCurrent;
+  if (_currentFilter != NULL)
+    currentMa = _currentFilter->filter(_loadCurrent);
+
+  // 2. Battery mV = ADC * (Vref * DividerRatio / Resolution)
+  _millivolts = (long)(((uint32_t)smoothRaw * _scale + 0x8000UL) >> 16);
+
+  // 3. Add back the I*R sag to estimate the resting voltage
+  _restMillivolts = _millivolts + currentMa * _rInternal / 1000;
+  _percentage = percentageOf(_restMillivolts);
+}
+
+/**
+ * @brief Voltage to 0-100 with the selected curve.
+ * Curves are 11 points (every 10%) of resting cell voltage; the result is
+ * interpolated between the two neighbours.
+ */
+int BatteryMonitor::percentageOf(long millivolts) const {
+  if (_chemistry == BATTERY_LINEAR)
+  {
+    // Linear mapping calculation
+    // (Current - Min) * 100 / (Max - Min)
+    long pct = (millivolts - _minMillivolts) * 100 / (_maxMillivolts - _minMillivolts);
+
+    // Clamp results between 0 and 100
+    if (pct > 100)
+      return 100;
+    if (pct < 0)
+      return 0;
+    return (int)pct;
+  }
+
+  const uint16_t* curve = (_chemistry == BATTERY_NIMH) ? NIMH_CURVE : LIPO_CURVE;
+  long mv = millivolts / _cells;
+  long lo = (long)pgm_read_word(&curve[0]);
+  if (mv <= lo)
     return 0;
-  
-  return pct;
+
+  int i;
+  i = 1;
+  while (i < 11)
+  {
+    long hi = (long)pgm_read_word(&curve[i]);
+    if (mv < hi)
+      return (int)((i - 1) * 10 + (mv - lo) * 10 / (hi - lo));
+    lo = hi;
+    i++;
+  }
+  return 100;
 }
 
-bool BatteryMonitor::isLow() {
+float BatteryMonitor::getVoltage() const {
+  return _millivolts * 0.001;
+}
+
+float BatteryMonitor::getRestingVoltage() const {
+  return _restMillivolts * 0.001;
+}
+
+long BatteryMonitor::getMillivolts() const {
+  return _millivolts;
+}
+
+int BatteryMonitor::getPercentage() const {
+  return _percentage;
+}
+
+bool BatteryMonitor::isLow() const {
   // Returns true if battery is below 10%
-  return getPercentage() < 10;
-}
\ No newline at end of file
+  return _percentage < BATTERY_LOW_PERCENT;
+}
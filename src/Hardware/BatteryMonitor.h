@@ -3,8 +3,8 @@
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief Battery Voltage Monitor with Noise Filtering.
  * Supports Voltage Dividers and Percentage calculation.
- * @version 1.0.0
- * @date 2025-12-30
+ * @version 1.3.1
+ * @date 2026-10-18
  *
  * @copyright Copyright (c) 2025 Furkan
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -19,20 +19,62 @@
 #include <Arduino.h>
 // Since this file is in Hardware/, we need to go up and into Utils/
 #include "../Utils/SignalFilter.h"
+#include "AnalogSampler.h"
+
+#define BATTERY_LINEAR 0 // Straight line between begin() minV and maxV
+#define BATTERY_LIPO   1 // LiPo / Li-ion discharge curve (per cell)
+#define BATTERY_NIMH   2 // NiMH discharge curve (per cell)
+
+#define BATTERY_FILTER_SIZE 20  // Samples averaged (x interval = time constant)
+#define BATTERY_LOW_PERCENT 10  // isLow() threshold
 
 /**
  * @brief Class to monitor battery status accurately.
  * Uses a Moving Average Filter to smooth out voltage spikes/drops during motor usage.
+ *
+ * update() samples the pack on a fixed schedule (Default: every 100 ms),
+ * so the filter's time constant is BATTERY_FILTER_SIZE * interval no
+ * matter how often the results are read. Voltage and percentage are
+ * cached there; the getters never touch the ADC.
+ *
+ * Percentage comes from a per-cell discharge curve (setChemistry()) and
+ * is computed from the load-compensated (resting) voltage:
+ * V_rest = V_terminal + I_load * R_internal, with I_load averaged over
+ * the same window as the voltage.
+ *
+ * Sampling runs in integer millivolts: the divider ratio, reference and
+ * ADC full scale are folded into one Q16 factor when they change.
  */
 class BatteryMonitor {
   private:
     int _pin;
     float _voltageDividerRatio; // Formula: (R1 + R2) / R2
     float _refVoltage;          // ADC Reference Voltage (3.3V or 5.0V)
-    float _minVoltage;          // 0% level
-    float _maxVoltage;          // 100% level
-    int _adcResolution;         // 1023 for 10-bit, 4095 for 12-bit
+    long _minMillivolts;        // 0% level
+    long _maxMillivolts;        // 100% level
+    long _adcResolution;        // 1023 for 10-bit, 4095 for 12-bit, more when oversampled
+    uint32_t _scale;            // Battery mV per ADC count (Q16)
     SignalFilter* _filter;      // Dynamic pointer to filter object
+    SignalFilter* _currentFilter; // Load current (mA), same window as _filter
+    AnalogSampler* _sampler;    // Background sampler (NULL = read on demand)
+    int _channel;               // Channel in _sampler
+
+    uint8_t _chemistry;         // BATTERY_LINEAR / LIPO / NIMH
+    uint8_t _cells;             // Cells in series
+    long _rInternal;            // Pack internal resistance (mOhm)
+    int _loadCurrent;           // Latest load current (mA)
+    unsigned long _interval;    // ms between samples
+    unsigned long _lastUpdate;
+
+    // --- Cached results ---
+    long _millivolts;           // Filtered terminal voltage
+    long _restMillivolts;       // Load-compensated voltage
+    int _percentage;
+
+    int readAdc();
+    void sample();
+    void updateScale();
+    int percentageOf(long millivolts) const;
 
   public:
     /**
@@ -50,29 +92,88 @@ class BatteryMonitor {
 
     /**
      * @brief Initializes the monitor and sets battery limits.
+     * Fills the filter with a first reading so the cached values are valid
+     * immediately (no false isLow() while the average ramps up).
      * * @param minV Voltage considered as 0% (e.g., 11.1V for 3S LiPo).
      * @param maxV Voltage considered as 100% (e.g., 12.6V for 3S LiPo).
      */
     void begin(float minV, float maxV);
-    
+
+    /**
+     * @brief Takes raw samples from a background AnalogSampler instead of
+     * analogRead(). Filtering still happens in update(), on this monitor's
+     * schedule. Call after begin().
+     * @return true if the sampler had a free channel.
+     */
+    bool attach(AnalogSampler& sampler);
+
+    /**
+     * @brief Oversamples the attached sampler channel for extra bits
+     * (see AnalogSampler::setOversampling()).
+     * @return true if attached (on-demand reads are never oversampled).
+     */
+    bool setOversampling(uint8_t bits);
+
+    /**
+     * @brief Heartbeat. Call frequently from loop().
+     * Takes a sample and refreshes the cached values when the interval is due.
+     */
+    void update();
+
     /**
-     * @brief Reads and calculates the actual battery voltage.
-     * Applies smoothing filter automatically.
+     * @brief Sampling interval (Default: 100 ms).
+     */
+    void setUpdateInterval(unsigned long ms);
+
+    /**
+     * @brief Selects the discharge curve used for getPercentage().
+     * The curves map resting (no-load) cell voltage to charge. Under load
+     * the terminal voltage sags by I * R, so without setInternalResistance()
+     * and setLoadCurrent() the percentage reads low while the motors run;
+     * BATTERY_LINEAR is the safer choice when no current is measured.
+     * @param chemistry BATTERY_LINEAR (Default), BATTERY_LIPO or BATTERY_NIMH.
+     * @param cells Cells in series (e.g. 3 for a 3S LiPo). Ignored for LINEAR.
+     */
+    void setChemistry(uint8_t chemistry, uint8_t cells = 1);
+
+    /**
+     * @brief Pack internal resistance used for load compensation (Default: 0).
+     */
+    void setInternalResistance(float ohms);
+
+    /**
+     * @brief Latest load current in Amps (e.g. from a current sensor).
+     * Averaged over the same window as the voltage in update().
+     */
+    void setLoadCurrent(float amps);
+
+    /**
+     * @brief Filtered terminal battery voltage (cached by update()).
      * @return float Voltage in Volts (e.g., 12.45).
      */
-    float getVoltage();
+    float getVoltage() const;
+
+    /**
+     * @brief Load-compensated (open-circuit estimate) voltage.
+     */
+    float getRestingVoltage() const;
+
+    /**
+     * @brief Filtered terminal voltage in millivolts.
+     */
+    long getMillivolts() const;
 
     /**
-     * @brief Calculates remaining battery percentage.
+     * @brief Remaining battery percentage (cached by update()).
      * @return int Percentage (0-100).
      */
-    int getPercentage();
+    int getPercentage() const;
 
     /**
      * @brief Checks if battery is below critical level (10%).
      * @return true If battery is critically low.
      */
-    bool isLow();
+    bool isLow() const;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,6 +1,6 @@
 #include "Button.h"
 
-Button::Button(int pin) {
+Button::Button(int pin) : _io(pin) {
   _pin = pin;
   _lastState = 0;
   _lastDebounceTime = 0;
@@ -15,13 +15,17 @@ void Button::begin() {
  * @brief Checks for a valid button press (Rising Edge) with debounce.
  */
 bool Button::isPressed() {
-  int currentState = digitalRead(_pin);
+  return isPressed(millis());
+}
+
+bool Button::isPressed(unsigned long now) {
+  int currentState = _io.read();
   bool result = false;
 
   // Logic: Check for rising edge (0 -> 1) and debounce delay
-  if (currentState == 1 && _lastState == 0 && (millis() - _lastDebounceTime > _debounceDelay))
+  if (currentState == 1 && _lastState == 0 && (now - _lastDebounceTime > _debounceDelay))
   {
-    _lastDebounceTime = millis();
+    _lastDebounceTime = now;
     result = true;
   }
   _lastState = currentState;
@@ -32,7 +36,11 @@ bool Button::isPressed() {
  * @brief Checks if the button is held down for a specific duration.
  */
 bool Button::isHeld(int duration) {
-  if (digitalRead(_pin) == 1 && (millis() - _lastDebounceTime > duration))
+  return isHeld(duration, millis());
+}
+
+bool Button::isHeld(int duration, unsigned long now) {
+  if (_io.read() == 1 && (now - _lastDebounceTime > (unsigned long)duration))
     return true;
   return false;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define BUTTON_H
 
 #include <Arduino.h>
+#include "FastPin.h"
 
 /**
  * @brief Handles physical button inputs with debouncing and hold detection.
@@ -10,6 +11,7 @@ class Button
 {
   private:
     int _pin;
+    FastPin _io;      // Port/mask resolved once
     int _lastState;
     unsigned long _lastDebounceTime;
     unsigned long _debounceDelay;
@@ -32,12 +34,23 @@ class Button
      */
     bool isPressed();
 
+    /**
+     * @brief Same as isPressed(), with the tick's time (e.g. TickClock::ms()).
+     * @param now Current time in milliseconds.
+     */
+    bool isPressed(unsigned long now);
+
     /**
      * @brief Checks if the button is currently held down.
      * @param duration The duration in milliseconds to consider as "held".
      * @return true if button is held longer than duration.
      */
     bool isHeld(int duration);
+
+    /**
+     * @param now Current time in milliseconds.
+     */
+    bool isHeld(int duration, unsigned long now);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,263 @@
+/**
+ * @file ButtonGroup.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of ButtonGroup class.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "ButtonGroup.h"
+
+/**
+ * @brief Index of the lowest set bit (mask must not be 0).
+ */
+static inline uint8_t lowestLane(uint32_t mask) {
+  return (uint8_t)__builtin_ctzl((unsigned long)mask);
+}
+
+ButtonGroup::ButtonGroup() {
+  _count = 0;
+  _used = 0;
+  _activeLow = 0;
+#if defined(__AVR__)
+  _portCount = 0;
+#endif
+  _state = 0;
+  _cnt0 = 0;
+  _cnt1 = 0;
+  _longPending = 0;
+  _clickArmed = 0;
+  _clickDone = 0;
+  _longPressMs = 800;
+  _doubleClickMs = 300;
+  _interval = 5;
+  _lastScan = 0;
+  _handler = NULL;
+}
+
+int ButtonGroup::add(uint8_t pin, bool activeLow) {
+  if (_count >= BUTTON_GROUP_MAX)
+    return -1;
+
+  // 1. Pick the lane
+  uint8_t lane;
+#if defined(__AVR__)
+  uint8_t port = digitalPinToPort(pin);
+  uint8_t mask = digitalPinToBitMask(pin);
+  if (port == NOT_A_PIN)
+    return -1;
+  uint8_t slot = 0;
+  while (slot < _portCount && _portId[slot] != port)
+    slot++;
+  if (slot == _portCount)
+  {
+    if (_portCount >= BUTTON_GROUP_PORTS)
+      return -1;
+    _portId[slot] = port;
+    _ports[slot] = portInputRegister(port);
+    _portCount++;
+  }
+  lane = slot * 8;
+  while (mask > 1)
+  {
+    mask >>= 1;
+    lane++;
+  }
+#else
+  lane = (uint8_t)_count;
+#endif
+  if (_used & (1UL << lane))
+    return -1; // Same pin twice
+
+  // 2. Pin mode and polarity
+  if (activeLow)
+  {
+    pinMode(pin, INPUT_PULLUP);
+    _activeLow |= 1UL << lane;
+  }
+  else
+  {
+  #ifdef INPUT_PULLDOWN
+    pinMode(pin, INPUT_PULLDOWN);
+  #else
+    pinMode(pin, INPUT);
+  #endif
+  }
+
+  _pins[_count] = pin;
+  _laneOf[_count] = lane;
+  _buttonOf[lane] = (uint8_t)_count;
+  _used |= 1UL << lane;
+  _count++;
+  return _count - 1;
+}
+
+/**
+ * @brief All lanes in one word, 1 = pressed.
+ */
+uint32_t ButtonGroup::sample() {
+  uint32_t raw = 0;
+  uint8_t i;
+
+#if defined(__AVR__)
+  // One PINx read per port, whatever the number of buttons on it
+  i = 0;
+  while (i < _portCount)
+  {
+    raw |= (uint32_t)(*_ports[i]) << (8 * i);
+    i++;
+  }
+#else
+  i = 0;
+  while (i < _count)
+  {
+    if (digitalRead(_pins[i]))
+      raw |= 1UL << _laneOf[i];
+    i++;
+  }
+#endif
+  return (raw ^ _activeLow) & _used;
+}
+
+void ButtonGroup::begin() {
+  _state = sample();
+  _cnt0 = 0;
+  _cnt1 = 0;
+  _longPending = 0;
+  _clickArmed = 0;
+  _clickDone = 0;
+  _lastScan = millis();
+}
+
+void ButtonGroup::update() {
+  unsigned long now = millis();
+  if (now - _lastScan < _interval)
+    return;
+  _lastScan = now;
+  scan();
+}
+
+void ButtonGroup::emit(uint8_t lane, uint8_t event) {
+  if (_handler != NULL)
+    _handler(_buttonOf[lane], event);
+}
+
+void ButtonGroup::scan() {
+  uint16_t now = (uint16_t)millis();
+  uint32_t s = sample();
+  uint32_t bit;
+  uint8_t lane;
+
+  // 1. Vertical counter: a lane flips after 4 scans in a row disagree
+  uint32_t delta = s ^ _state;
+  _cnt1 = (_cnt1 ^ _cnt0) & delta;
+  _cnt0 = ~_cnt0 & delta;
+  uint32_t toggled = delta & ~(_cnt0 | _cnt1);
+  _state ^= toggled;
+
+  // 2. Presses (a quick second press after a short click is a double click)
+  uint32_t lanes = toggled & _state;
+  while (lanes)
+  {
+    lane = lowestLane(lanes);
+    bit = 1UL << lane;
+    lanes &= lanes - 1;
+
+    emit(lane, BUTTON_EVENT_PRESS);
+    if ((_clickArmed & bit) && (uint16_t)(now - _releaseTime[lane]) <= _doubleClickMs)
+    {
+      emit(lane, BUTTON_EVENT_DOUBLE_CLICK);
+      _clickDone |= bit;
+    }
+    _clickArmed &= ~bit;
+    _pressTime[lane] = now;
+    _longPending |= bit;
+  }
+
+  // 3. Releases (a release before the long-press time arms a double click,
+  //    unless that press already completed one)
+  lanes = toggled & ~_state;
+  while (lanes)
+  {
+    lane = lowestLane(lanes);
+    bit = 1UL << lane;
+    lanes &= lanes - 1;
+
+    emit(lane, BUTTON_EVENT_RELEASE);
+    if ((_longPending & bit) && !(_clickDone & bit))
+      _clickArmed |= bit;
+    _longPending &= ~bit;
+    _clickDone &= ~bit;
+    _releaseTime[lane] = now;
+  }
+
+  // 4. Long presses: only lanes still held and not yet reported
+  lanes = _longPending;
+  while (lanes)
+  {
+    lane = lowestLane(lanes);
+    bit = 1UL << lane;
+    lanes &= lanes - 1;
+
+    if ((uint16_t)(now - _pressTime[lane]) >= _longPressMs)
+    {
+      emit(lane, BUTTON_EVENT_LONG_PRESS);
+      _longPending &= ~bit;
+    }
+  }
+
+  // 5. Expire double-click windows (so a 16-bit wrap can never fake one)
+  lanes = _clickArmed;
+  while (lanes)
+  {
+    lane = lowestLane(lanes);
+    lanes &= lanes - 1;
+    if ((uint16_t)(now - _releaseTime[lane]) > _doubleClickMs)
+      _clickArmed &= ~(1UL << lane);
+  }
+}
+
+void ButtonGroup::setInterval(unsigned long ms) {
+  _interval = ms;
+}
+
+void ButtonGroup::setLongPressTime(uint16_t ms) {
+  _longPressMs = ms;
+}
+
+void ButtonGroup::setDoubleClickTime(uint16_t ms) {
+  _doubleClickMs = ms;
+}
+
+void ButtonGroup::setHandler(ButtonEventHandler handler) {
+  _handler = handler;
+}
+
+bool ButtonGroup::isDown(int button) const {
+  if (button < 0 || button >= _count)
+    return false;
+  return (_state >> _laneOf[button]) & 1;
+}
+
+uint32_t ButtonGroup::getPressedMask() const {
+  uint32_t mask = 0;
+  int i;
+  i = 0;
+  while (i < _count)
+  {
+    if ((_state >> _laneOf[i]) & 1)
+      mask |= 1UL << i;
+    i++;
+  }
+  return mask;
+}
+
+int ButtonGroup::getCount() const {
+  return _count;
+}
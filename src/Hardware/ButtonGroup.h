@@ -0,0 +1,153 @@
+/**
+ * @file ButtonGroup.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Port-Parallel Button Scanner with Vertical-Counter Debouncing.
+ * Reads whole GPIO ports at once and debounces every button in parallel
+ * with bitwise counters, then reports press / release / long-press /
+ * double-click events from a single update().
+ * @version 1.0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef BUTTON_GROUP_H
+#define BUTTON_GROUP_H
+
+#include <Arduino.h>
+
+#define BUTTON_GROUP_MAX   32 // Buttons per group (one bit lane each)
+#define BUTTON_GROUP_PORTS 4  // AVR: distinct ports per group (8 lanes each)
+
+// Event types
+#define BUTTON_EVENT_PRESS        0
+#define BUTTON_EVENT_RELEASE      1
+#define BUTTON_EVENT_LONG_PRESS   2 // Still held after the long-press time
+#define BUTTON_EVENT_DOUBLE_CLICK 3 // Second press within the double-click time
+
+typedef void (*ButtonEventHandler)(uint8_t button, uint8_t event);
+
+/**
+ * @brief Up to BUTTON_GROUP_MAX buttons scanned as one 32-bit word.
+ *
+ * Every button is a bit lane. On AVR the lane is the button's bit in its
+ * port, so one scan is one PINx read per port used (at most
+ * BUTTON_GROUP_PORTS). The whole-port scan is AVR-only: every other
+ * core, STM32 / OpenCM included, falls back to one digitalRead() per
+ * button, so a scan there costs as much as reading the pins one by one.
+ *
+ * Debouncing is a 2-bit vertical counter per lane: a lane's debounced
+ * state flips only after 4 consecutive scans disagree with it, computed
+ * for all 32 lanes with a handful of AND/XOR operations. At the default
+ * 5 ms scan interval that is a 20 ms debounce.
+ *
+ * Event logic only visits lanes that changed or are being held, so the
+ * cost of a quiet scan does not depend on the number of buttons.
+ *
+ * Usage Example:
+ * ButtonGroup panel;
+ * int start = panel.add(4);   // Active-low, internal pull-up
+ * int stop = panel.add(5);
+ * panel.setHandler(onButton); // void onButton(uint8_t button, uint8_t event)
+ * panel.begin();
+ * // loop(): panel.update();
+ */
+class ButtonGroup {
+  private:
+    int _count;
+    uint8_t _pins[BUTTON_GROUP_MAX];
+    uint8_t _laneOf[BUTTON_GROUP_MAX];   // Button -> lane
+    uint8_t _buttonOf[BUTTON_GROUP_MAX]; // Lane -> button
+    uint32_t _used;                      // Lanes in use
+    uint32_t _activeLow;                 // Lanes that read LOW when pressed
+
+#if defined(__AVR__)
+    volatile uint8_t* _ports[BUTTON_GROUP_PORTS]; // PINx of each port slot
+    uint8_t _portId[BUTTON_GROUP_PORTS];
+    uint8_t _portCount;
+#endif
+
+    // --- Vertical counter debouncer ---
+    uint32_t _state;                     // Debounced, 1 = pressed
+    uint32_t _cnt0;
+    uint32_t _cnt1;
+
+    // --- Event timing (ms, 16-bit wraps after 65 s; intervals are shorter) ---
+    uint16_t _pressTime[BUTTON_GROUP_MAX];
+    uint16_t _releaseTime[BUTTON_GROUP_MAX];
+    uint32_t _longPending;               // Held, long-press not yet reported
+    uint32_t _clickArmed;                // Last press was a short click
+    uint32_t _clickDone;                 // Current press completed a double click
+    uint16_t _longPressMs;
+    uint16_t _doubleClickMs;
+
+    unsigned long _interval;             // ms between scans
+    unsigned long _lastScan;
+    ButtonEventHandler _handler;
+
+    uint32_t sample();
+    void emit(uint8_t lane, uint8_t event);
+
+  public:
+    ButtonGroup();
+
+    /**
+     * @brief Adds a button.
+     * @param pin Digital pin.
+     * @param activeLow true: pressed = LOW, internal pull-up (Default).
+     * false: pressed = HIGH (INPUT_PULLDOWN where available, else INPUT).
+     * @return int Button index for events and queries, or -1 if the group
+     * is full (or, on AVR, the pin is on a fifth port).
+     */
+    int add(uint8_t pin, bool activeLow = true);
+
+    /**
+     * @brief Takes the current levels as the debounced state (no events).
+     */
+    void begin();
+
+    /**
+     * @brief Heartbeat. Call frequently from loop(); scans every interval.
+     */
+    void update();
+
+    /**
+     * @brief Runs one scan now: sample, debounce, emit events.
+     */
+    void scan();
+
+    /**
+     * @brief Scan interval (Default: 5 ms; debounce = 4 scans).
+     */
+    void setInterval(unsigned long ms);
+
+    /**
+     * @brief Hold time for BUTTON_EVENT_LONG_PRESS (Default: 800 ms).
+     */
+    void setLongPressTime(uint16_t ms);
+
+    /**
+     * @brief Max release-to-press gap for BUTTON_EVENT_DOUBLE_CLICK (Default: 300 ms).
+     */
+    void setDoubleClickTime(uint16_t ms);
+
+    void setHandler(ButtonEventHandler handler);
+
+    /**
+     * @brief Debounced state of one button.
+     */
+    bool isDown(int button) const;
+
+    /**
+     * @brief Debounced states of all buttons, bit i = button i.
+     */
+    uint32_t getPressedMask() const;
+
+    int getCount() const;
+};
+
+#endif
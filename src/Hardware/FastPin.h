@@ -0,0 +1,173 @@
+/**
+ * @file FastPin.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Direct-Register Digital Pin I/O.
+ * Resolves a pin's port registers and bit mask once, so reads and writes
+ * are single register accesses instead of a digitalRead()/digitalWrite()
+ * table walk on every call.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef FAST_PIN_H
+#define FAST_PIN_H
+
+#include <Arduino.h>
+
+// STM32duino core (ARDUINO_ARCH_STM32): GPIO_TypeDef port with BSRR / IDR.
+// The ROBOTIS OpenCM9.04 core and Roger Clark's STM32F1 core do not
+// define portSetRegister() this way and take the portable fallback.
+#if !defined(__AVR__) && defined(ARDUINO_ARCH_STM32) && defined(portSetRegister)
+#define FAST_PIN_BSRR
+#endif
+
+/**
+ * @brief One digital pin with its registers cached at construction.
+ *
+ * AVR: read() is one PINx load, toggle() one PINx store (writing a 1 to
+ * PINx flips the output on every current AVR), write()/high()/low() a
+ * PORTx read-modify-write with interrupts held off for those 3 cycles,
+ * so an ISR changing another pin of the same port is never undone.
+ *
+ * STM32duino: write() is one BSRR store (set or reset half, atomic by
+ * hardware), read() one IDR load, toggle() an ODR load plus a BSRR store.
+ *
+ * Every other core, the ROBOTIS OpenCM9.04 core included, falls back to
+ * digitalRead()/digitalWrite() and gets no speed-up from FastPin.
+ *
+ * Methods are inline on purpose: a call would cost more than the access.
+ * Unlike digitalWrite(), write() does not switch off a PWM timer on the
+ * pin; call digitalWrite() once if the pin was used with analogWrite().
+ *
+ * Usage Example:
+ * FastPin led(13);
+ * led.mode(OUTPUT);
+ * led.toggle();
+ */
+class FastPin {
+  private:
+    uint8_t _pin;
+    uint8_t _level;          // Last written level (fallback toggle)
+#if defined(__AVR__)
+    volatile uint8_t* _out;  // PORTx (NULL = not a pin)
+    volatile uint8_t* _in;   // PINx
+    uint8_t _mask;
+#elif defined(FAST_PIN_BSRR)
+    GPIO_TypeDef* _port;     // NULL = not a pin
+    uint32_t _mask;
+#endif
+
+  public:
+    /**
+     * @param pin Arduino pin number.
+     */
+    FastPin(uint8_t pin) {
+      _pin = pin;
+      _level = LOW;
+#if defined(__AVR__)
+      uint8_t port = digitalPinToPort(pin);
+      _mask = digitalPinToBitMask(pin);
+      if (port == NOT_A_PIN)
+      {
+        _out = NULL;
+        _in = NULL;
+      }
+      else
+      {
+        _out = portOutputRegister(port);
+        _in = portInputRegister(port);
+      }
+#elif defined(FAST_PIN_BSRR)
+      if (pin >= NUM_DIGITAL_PINS)
+      {
+        _port = NULL;
+        _mask = 0;
+      }
+      else
+      {
+        _port = digitalPinToPort(pin);
+        _mask = digitalPinToBitMask(pin);
+      }
+#endif
+    }
+
+    /**
+     * @brief Same as pinMode() (INPUT, OUTPUT, INPUT_PULLUP, ...).
+     */
+    void mode(uint8_t mode) {
+      pinMode(_pin, mode);
+    }
+
+    inline void write(uint8_t level) {
+#if defined(__AVR__)
+      if (_out == NULL)
+        return;
+      uint8_t sreg = SREG;
+      cli();
+      if (level)
+        *_out |= _mask;
+      else
+        *_out &= ~_mask;
+      SREG = sreg;
+#elif defined(FAST_PIN_BSRR)
+      if (_port == NULL)
+        return;
+      // Low half sets, high half resets
+      _port->BSRR = level ? _mask : (_mask << 16);
+#else
+      digitalWrite(_pin, level ? HIGH : LOW);
+#endif
+      _level = level ? HIGH : LOW;
+    }
+
+    inline void high() {
+      write(HIGH);
+    }
+
+    inline void low() {
+      write(LOW);
+    }
+
+    inline void toggle() {
+#if defined(__AVR__)
+      if (_in != NULL)
+        *_in = _mask;
+      _level = !_level;
+#elif defined(FAST_PIN_BSRR)
+      if (_port == NULL)
+        return;
+      write((_port->ODR & _mask) ? LOW : HIGH);
+#else
+      write(!_level);
+#endif
+    }
+
+    /**
+     * @return HIGH or LOW.
+     */
+    inline uint8_t read() const {
+#if defined(__AVR__)
+      if (_in == NULL)
+        return LOW;
+      return (*_in & _mask) ? HIGH : LOW;
+#elif defined(FAST_PIN_BSRR)
+      if (_port == NULL)
+        return LOW;
+      return (_port->IDR & _mask) ? HIGH : LOW;
+#else
+      return digitalRead(_pin) ? HIGH : LOW;
+#endif
+    }
+
+    uint8_t getPin() const {
+      return _pin;
+    }
+};
+
+#endif
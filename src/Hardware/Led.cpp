@@ -1,10 +1,10 @@
 #include "Led.h"
 
-Led::Led(int pin) {
+Led::Led(int pin) : _io(pin) {
   _pin = pin;
   _state = 1; // Default state (Assuming Active Low for OpenCM)
   _previousMillis = 0;
-  digitalWrite(_pin, _state);
+  _io.write(_state);
 }
 
 void Led::begin() {
@@ -13,26 +13,30 @@ void Led::begin() {
 
 void Led::turnOn() {
   _state = 0; // Active Low
-  digitalWrite(_pin, _state);
+  _io.write(_state);
 }
 
 void Led::turnOff() {
   _state = 1;
-  digitalWrite(_pin, _state);
+  _io.write(_state);
 }
 
 void Led::toggle() {
   _state = !_state;
-  digitalWrite(_pin, _state);
+  _io.write(_state);
 }
 
 /**
  * @brief Non-blocking blink function based on millis().
  */
 void Led::blink(int interval) {
-  if (millis() - _previousMillis >= interval)
+  blink(interval, millis());
+}
+
+void Led::blink(int interval, unsigned long now) {
+  if (now - _previousMillis >= (unsigned long)interval)
   {
-    _previousMillis = millis();
+    _previousMillis = now;
     toggle();
   }
 }
\ No newline at end of file
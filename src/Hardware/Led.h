@@ -2,6 +2,7 @@
 #define LED_H
 
 #include <Arduino.h>
+#include "FastPin.h"
 
 /**
  * @brief Manages LED output with non-blocking blink and toggle features.
@@ -10,6 +11,7 @@ class Led
 {
   private:
     int _pin;
+    FastPin _io;      // Port/mask resolved once
     bool _state;
     unsigned long _previousMillis;
 
@@ -45,6 +47,12 @@ class Led
      * @param interval Blink interval in milliseconds.
      */
     void blink(int interval);
+
+    /**
+     * @brief Same as blink(), with the tick's time (e.g. TickClock::ms()).
+     * @param now Current time in milliseconds.
+     */
+    void blink(int interval, unsigned long now);
 };
 
 #endif
\ No newline at end of file
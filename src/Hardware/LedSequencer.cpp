@@ -0,0 +1,283 @@
+/**
+ * @file LedSequencer.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of LedSequencer class.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "LedSequencer.h"
+
+// { step (10 ms), steps, levels... }
+const uint8_t LED_BLINK_SLOW[] PROGMEM = { 50, 2, 255, 0 };
+const uint8_t LED_BLINK_FAST[] PROGMEM = { 10, 2, 255, 0 };
+const uint8_t LED_HEARTBEAT[] PROGMEM = { 10, 10, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0 };
+// Squared ramp so the fade looks even to the eye
+const uint8_t LED_BREATHE[] PROGMEM = { 6, 32,
+  0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144, 169, 196, 225,
+  255, 225, 196, 169, 144, 121, 100, 81, 64, 49, 36, 25, 16, 9, 4, 1
+};
+
+LedSequencer::LedSequencer() {
+  _count = 0;
+  _used = 0;
+  _activeLow = 0;
+#if defined(__AVR__)
+  _portCount = 0;
+#else
+  _shown = 0;
+#endif
+  _dirty = 0;
+  int i;
+  i = 0;
+  while (i < LED_SEQ_BITS)
+  {
+    _plane[i] = 0;
+    i++;
+  }
+  _tick = 0;
+  _bit = 0;
+  _stepUs = 0;
+  _tickUs = 125;
+  _lastTick = 0;
+}
+
+int LedSequencer::add(uint8_t pin, bool activeLow) {
+  if (_count >= LED_SEQ_MAX)
+    return -1;
+
+  // 1. Pick the lane
+  uint8_t lane;
+#if defined(__AVR__)
+  uint8_t port = digitalPinToPort(pin);
+  uint8_t mask = digitalPinToBitMask(pin);
+  if (port == NOT_A_PIN)
+    return -1;
+  uint8_t slot = 0;
+  while (slot < _portCount && _portId[slot] != port)
+    slot++;
+  if (slot == _portCount)
+  {
+    if (_portCount >= LED_SEQ_PORTS)
+      return -1;
+    _portId[slot] = port;
+    _ports[slot] = portOutputRegister(port);
+    _portMask[slot] = 0;
+    _portCount++;
+  }
+  if (_portMask[slot] & mask)
+    return -1; // Same pin twice
+  _portMask[slot] |= mask;
+  lane = slot * 8;
+  while (mask > 1)
+  {
+    mask >>= 1;
+    lane++;
+  }
+#else
+  lane = (uint8_t)_count;
+#endif
+
+  // 2. Output, off
+  pinMode(pin, OUTPUT);
+  digitalWrite(pin, activeLow ? HIGH : LOW);
+  if (activeLow)
+  {
+    _activeLow |= 1UL << lane;
+  #if !defined(__AVR__)
+    _shown |= 1UL << lane;
+  #endif
+  }
+
+  _pins[_count] = pin;
+  _laneOf[_count] = lane;
+  _level[_count] = 0;
+  _pattern[_count] = NULL;
+  _step[_count] = 0;
+  _countdown[_count] = 0;
+  _used |= 1UL << lane;
+  _count++;
+  return _count - 1;
+}
+
+void LedSequencer::begin(unsigned long tickUs) {
+  _tickUs = (tickUs == 0) ? 1 : tickUs;
+  _tick = 0;
+  _bit = 0;
+  _stepUs = 0;
+  endFrame();
+  show(_plane[0]);
+  _lastTick = micros();
+}
+
+/**
+ * @brief Puts one bit plane on the pins (1 = lit).
+ */
+void LedSequencer::show(uint32_t bits) {
+  uint32_t levels = bits ^ _activeLow;
+
+#if defined(__AVR__)
+  // One read-modify-write per port, interrupts off so a concurrent
+  // write to another pin of the port is not lost
+  uint8_t s;
+  s = 0;
+  while (s < _portCount)
+  {
+    uint8_t v = (uint8_t)(levels >> (8 * s)) & _portMask[s];
+    uint8_t sreg = SREG;
+    cli();
+    *_ports[s] = (*_ports[s] & ~_portMask[s]) | v;
+    SREG = sreg;
+    s++;
+  }
+#else
+  // Only the LEDs whose output changes
+  uint32_t changed = (levels ^ _shown) & _used;
+  while (changed)
+  {
+    uint8_t lane = (uint8_t)__builtin_ctzl((unsigned long)changed);
+    changed &= changed - 1;
+    digitalWrite(_pins[lane], ((levels >> lane) & 1) ? HIGH : LOW);
+  }
+  _shown = levels;
+#endif
+}
+
+/**
+ * @brief Loads the current pattern step of one LED.
+ */
+void LedSequencer::loadStep(int led) {
+  const uint8_t* p = _pattern[led];
+  uint8_t steps = pgm_read_byte(p + 1);
+  if (_step[led] >= steps)
+    _step[led] = 0;
+  _level[led] = (steps == 0) ? 0 : pgm_read_byte(p + 2 + _step[led]);
+  _countdown[led] = pgm_read_byte(p);
+  if (_countdown[led] == 0)
+    _countdown[led] = 1;
+  _dirty |= 1UL << led;
+}
+
+/**
+ * @brief Frame boundary: advance patterns, rebuild changed bit planes.
+ */
+void LedSequencer::endFrame() {
+  int i;
+
+  // 1. Pattern clock (10 ms units)
+  _stepUs += LED_SEQ_FRAME * _tickUs;
+  while (_stepUs >= LED_SEQ_STEP_US)
+  {
+    _stepUs -= LED_SEQ_STEP_US;
+    i = 0;
+    while (i < _count)
+    {
+      if (_pattern[i] != NULL && --_countdown[i] == 0)
+      {
+        _step[i]++;
+        loadStep(i);
+      }
+      i++;
+    }
+  }
+
+  // 2. Bit planes of the LEDs that changed level
+  uint32_t dirty = _dirty;
+  _dirty = 0;
+  while (dirty)
+  {
+    int led = __builtin_ctzl((unsigned long)dirty);
+    dirty &= dirty - 1;
+
+    uint32_t bit = 1UL << _laneOf[led];
+    uint8_t v = _level[led] >> (8 - LED_SEQ_BITS);
+    uint8_t b;
+    b = 0;
+    while (b < LED_SEQ_BITS)
+    {
+      if ((v >> b) & 1)
+        _plane[b] |= bit;
+      else
+        _plane[b] &= ~bit;
+      b++;
+    }
+  }
+}
+
+void LedSequencer::tick() {
+  _tick++;
+  if (_tick >= LED_SEQ_FRAME)
+  {
+    _tick = 0;
+    _bit = 0;
+    endFrame();
+    show(_plane[0]);
+    return;
+  }
+
+  // Bit b starts at tick 2^b - 1 and lasts 2^b ticks
+  if ((_tick & (_tick + 1)) == 0)
+  {
+    _bit++;
+    show(_plane[_bit]);
+  }
+}
+
+void LedSequencer::update() {
+  unsigned long now = micros();
+
+  // Fell a whole frame behind: skip ahead instead of bursting
+  if (now - _lastTick > (unsigned long)LED_SEQ_FRAME * _tickUs)
+    _lastTick = now - _tickUs;
+
+  while (now - _lastTick >= _tickUs)
+  {
+    _lastTick += _tickUs;
+    tick();
+  }
+}
+
+void LedSequencer::setBrightness(int led, uint8_t level) {
+  if (led < 0 || led >= _count)
+    return;
+  noInterrupts();
+  _pattern[led] = NULL;
+  _level[led] = level;
+  _dirty |= 1UL << led;
+  interrupts();
+}
+
+void LedSequencer::on(int led) {
+  setBrightness(led, 255);
+}
+
+void LedSequencer::off(int led) {
+  setBrightness(led, 0);
+}
+
+void LedSequencer::setPattern(int led, const uint8_t* pattern) {
+  if (led < 0 || led >= _count)
+    return;
+  noInterrupts();
+  _pattern[led] = pattern;
+  _step[led] = 0;
+  if (pattern != NULL)
+    loadStep(led);
+  interrupts();
+}
+
+uint8_t LedSequencer::getBrightness(int led) const {
+  if (led < 0 || led >= _count)
+    return 0;
+  return _level[led];
+}
+
+int LedSequencer::getCount() const {
+  return _count;
+}
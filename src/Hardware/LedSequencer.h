@@ -0,0 +1,152 @@
+/**
+ * @file LedSequencer.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Tick-Driven LED Sequencer with Software PWM (BAM).
+ * Drives many LEDs from one periodic tick: brightness by Bit Angle
+ * Modulation, blink / breathe patterns from flash tables, and outputs
+ * written a whole port at a time on AVR where LEDs share a port.
+ * @version 1.0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef LED_SEQUENCER_H
+#define LED_SEQUENCER_H
+
+#include <Arduino.h>
+
+#define LED_SEQ_MAX     32 // LEDs per sequencer (one bit lane each)
+#define LED_SEQ_PORTS   4  // AVR: distinct ports per sequencer (8 lanes each)
+#define LED_SEQ_BITS    6  // Brightness resolution (64 levels)
+#define LED_SEQ_FRAME   ((1 << LED_SEQ_BITS) - 1) // Ticks per PWM frame
+#define LED_SEQ_STEP_US 10000UL // Pattern time unit (10 ms)
+
+/*
+ * Pattern table layout (PROGMEM bytes):
+ * { step time in 10 ms units, number of steps, level 0, level 1, ... }
+ * Levels are 0-255. Patterns loop until replaced.
+ *
+ * const uint8_t MY_SOS[] PROGMEM = { 15, 6, 255, 0, 255, 0, 255, 0 };
+ */
+extern const uint8_t LED_BLINK_SLOW[] PROGMEM; // 1 Hz
+extern const uint8_t LED_BLINK_FAST[] PROGMEM; // 5 Hz
+extern const uint8_t LED_HEARTBEAT[] PROGMEM;  // Two flashes, pause
+extern const uint8_t LED_BREATHE[] PROGMEM;    // ~2 s fade in / out
+
+/**
+ * @brief Up to LED_SEQ_MAX LEDs on one BAM tick.
+ *
+ * Brightness is LED_SEQ_BITS bit planes. Bit b of every LED is shown for
+ * 2^b ticks, so a frame is LED_SEQ_FRAME ticks and outputs only change
+ * LED_SEQ_BITS times per frame; the other ticks just count. At the
+ * default 125 us tick a frame is 7.9 ms (127 Hz, flicker-free).
+ *
+ * On AVR an LED is the bit of its port, and a plane change is one
+ * read-modify-write per port used (at most LED_SEQ_PORTS). The batched
+ * port write is AVR-only: every other core, STM32 / OpenCM included,
+ * falls back to one digitalWrite() per LED whose output actually changes.
+ *
+ * Pattern steps and brightness changes are applied at the frame
+ * boundary, inside the tick, so the ISR never races the setters and the
+ * worst-case tick is bounded by the LED count.
+ *
+ * Usage Example:
+ * LedSequencer leds;
+ * int status = leds.add(13);
+ * leds.begin();
+ * leds.setPattern(status, LED_BREATHE);
+ * // loop(): leds.update();   (or call leds.tick() from a 125 us timer ISR)
+ */
+class LedSequencer {
+  private:
+    int _count;
+    uint8_t _pins[LED_SEQ_MAX];
+    uint8_t _laneOf[LED_SEQ_MAX];
+    uint32_t _used;
+    uint32_t _activeLow;
+
+#if defined(__AVR__)
+    volatile uint8_t* _ports[LED_SEQ_PORTS]; // PORTx of each port slot
+    uint8_t _portId[LED_SEQ_PORTS];
+    uint8_t _portMask[LED_SEQ_PORTS];        // Bits owned by the sequencer
+    uint8_t _portCount;
+#else
+    uint32_t _shown;                         // Levels on the pins now
+#endif
+
+    // --- Per LED (written by setters with interrupts off) ---
+    uint8_t _level[LED_SEQ_MAX];             // 0-255 as requested
+    const uint8_t* _pattern[LED_SEQ_MAX];    // NULL = steady level
+    uint8_t _step[LED_SEQ_MAX];
+    uint8_t _countdown[LED_SEQ_MAX];         // 10 ms units left in the step
+    volatile uint32_t _dirty;                // Lanes to rebuild at frame end
+
+    // --- BAM state (tick only) ---
+    uint32_t _plane[LED_SEQ_BITS];
+    uint8_t _tick;
+    uint8_t _bit;
+    unsigned long _stepUs;                   // Frame time towards the next 10 ms step
+
+    unsigned long _tickUs;
+    unsigned long _lastTick;
+
+    void show(uint32_t bits);
+    void endFrame();
+    void loadStep(int led);
+
+  public:
+    LedSequencer();
+
+    /**
+     * @brief Adds an LED (starts off).
+     * @param pin Digital pin.
+     * @param activeLow true if the LED lights when the pin is LOW.
+     * @return int LED index, or -1 if full (or, on AVR, a fifth port).
+     */
+    int add(uint8_t pin, bool activeLow = false);
+
+    /**
+     * @param tickUs Period of tick() calls in microseconds (Default: 125).
+     * Only used for pattern timing and by update().
+     */
+    void begin(unsigned long tickUs = 125);
+
+    /**
+     * @brief One BAM tick. Safe to call from a timer interrupt.
+     */
+    void tick();
+
+    /**
+     * @brief Runs the ticks due since the last call, from micros().
+     * Use when no timer interrupt is available; call as often as possible.
+     */
+    void update();
+
+    /**
+     * @brief Steady brightness, stops any pattern on the LED.
+     * @param level 0 (off) - 255 (full).
+     */
+    void setBrightness(int led, uint8_t level);
+
+    void on(int led);
+    void off(int led);
+
+    /**
+     * @brief Plays a PROGMEM pattern table in a loop (NULL = stop, keep level).
+     */
+    void setPattern(int led, const uint8_t* pattern);
+
+    /**
+     * @brief Current requested level (0-255), pattern step included.
+     */
+    uint8_t getBrightness(int led) const;
+
+    int getCount() const;
+};
+
+#endif
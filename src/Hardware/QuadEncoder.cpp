@@ -0,0 +1,189 @@
+/**
+ * @file QuadEncoder.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of QuadEncoder.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "QuadEncoder.h"
+
+// Index: (previous AB << 2) | current AB. 0 = no move or invalid (both changed).
+static const int8_t QUAD_TABLE[16] PROGMEM = {
+   0, -1,  1,  0,
+   1,  0,  0, -1,
+  -1,  0,  0,  1,
+   0,  1, -1,  0
+};
+
+QuadEncoder* QuadEncoder::_instances[ENCODER_MAX_COUNT] = {NULL};
+
+// attachInterrupt() takes a plain function, so each slot gets a trampoline
+void QuadEncoder::isr0() { _instances[0]->handleEdge(); }
+void QuadEncoder::isr1() { _instances[1]->handleEdge(); }
+void QuadEncoder::isr2() { _instances[2]->handleEdge(); }
+void QuadEncoder::isr3() { _instances[3]->handleEdge(); }
+
+QuadEncoder::QuadEncoder(int pinA, int pinB, float countsPerRev) : _a(pinA), _b(pinB) {
+  _pinA = pinA;
+  _pinB = pinB;
+  _countsPerRev = (countsPerRev > 0.0) ? countsPerRev : 1.0;
+
+  _count = 0;
+  _state = 0;
+  _dir = 0;
+  _edgeTime = 0;
+  _period = 0;
+
+  _prevCount = 0;
+  _prevEdgeTime = 0;
+  _switchEdges = 4;
+  _stopTimeout = 100000UL;
+  _velocity = 0.0;
+  _slot = -1;
+}
+
+uint8_t QuadEncoder::readState() {
+  return (uint8_t)((_a.read() ? 2 : 0) | (_b.read() ? 1 : 0));
+}
+
+bool QuadEncoder::begin() {
+  static void (*const trampolines[ENCODER_MAX_COUNT])() = {isr0, isr1, isr2, isr3};
+  int intA = digitalPinToInterrupt(_pinA);
+  int intB = digitalPinToInterrupt(_pinB);
+  int i;
+
+  if (_slot >= 0)
+    return true;
+  if (intA == NOT_AN_INTERRUPT || intB == NOT_AN_INTERRUPT)
+    return false;
+
+  i = 0;
+  while (i < ENCODER_MAX_COUNT && _instances[i] != NULL)
+    i++;
+  if (i == ENCODER_MAX_COUNT)
+    return false;
+
+  pinMode(_pinA, INPUT_PULLUP);
+  pinMode(_pinB, INPUT_PULLUP);
+  _state = readState();
+  _edgeTime = micros();
+  _prevEdgeTime = _edgeTime;
+
+  _slot = i;
+  _instances[i] = this;
+  attachInterrupt(intA, trampolines[i], CHANGE);
+  attachInterrupt(intB, trampolines[i], CHANGE);
+  return true;
+}
+
+void QuadEncoder::end() {
+  if (_slot < 0)
+    return;
+  detachInterrupt(digitalPinToInterrupt(_pinA));
+  detachInterrupt(digitalPinToInterrupt(_pinB));
+  _instances[_slot] = NULL;
+  _slot = -1;
+}
+
+/**
+ * @brief ISR body: two pin reads, one table lookup, one timestamp.
+ */
+void QuadEncoder::handleEdge() {
+  uint8_t now = readState();
+  int8_t step = (int8_t)pgm_read_byte(&QUAD_TABLE[(_state << 2) | now]);
+  _state = now;
+  if (step == 0)
+    return;
+
+  unsigned long t = micros();
+  // A reversal makes the last period meaningless for speed
+  _period = (step == _dir) ? (t - _edgeTime) : 0;
+  _edgeTime = t;
+  _dir = step;
+  _count += step;
+}
+
+long QuadEncoder::getCount() {
+  noInterrupts();
+  long c = _count;
+  interrupts();
+  return c;
+}
+
+void QuadEncoder::setCount(long count) {
+  noInterrupts();
+  _count = count;
+  interrupts();
+  _prevCount = count;
+}
+
+void QuadEncoder::setSwitchEdges(int edges) {
+  _switchEdges = (edges < 1) ? 1 : edges;
+}
+
+void QuadEncoder::setStopTimeout(unsigned long us) {
+  _stopTimeout = us;
+}
+
+/**
+ * @brief Adaptive velocity estimation from one atomic snapshot.
+ */
+void QuadEncoder::update() {
+  // 1. Snapshot (multi-byte values must not tear mid-ISR)
+  noInterrupts();
+  long count = _count;
+  unsigned long edgeTime = _edgeTime;
+  unsigned long period = _period;
+  int8_t dir = _dir;
+  interrupts();
+  unsigned long now = micros();
+
+  long edges = count - _prevCount;
+  long absEdges = (edges < 0) ? -edges : edges;
+  unsigned long sinceEdge = now - edgeTime;
+
+  if (absEdges >= _switchEdges && edgeTime != _prevEdgeTime)
+  {
+    // 2a. High speed: edges over the exact time they took
+    _velocity = (float)edges * 1000000.0 / (float)(edgeTime - _prevEdgeTime);
+  }
+  else if (sinceEdge >= _stopTimeout)
+  {
+    // 2b. No edge for too long: stopped
+    _velocity = 0.0;
+  }
+  else if (period > 0)
+  {
+    // 2c. Low speed: 1/T. If the next edge is late, the true speed is
+    // at most 1 / (time since the last edge), so decay towards it.
+    unsigned long t = (sinceEdge > period) ? sinceEdge : period;
+    _velocity = (float)dir * 1000000.0 / (float)t;
+  }
+  else if (edges != 0 && edgeTime != _prevEdgeTime)
+  {
+    // 2d. Period unknown (first edge or reversal): fall back to counting
+    _velocity = (float)edges * 1000000.0 / (float)(edgeTime - _prevEdgeTime);
+  }
+
+  _prevCount = count;
+  _prevEdgeTime = edgeTime;
+}
+
+float QuadEncoder::getVelocity() {
+  return _velocity;
+}
+
+float QuadEncoder::getRPM() {
+  return _velocity * 60.0 / _countsPerRev;
+}
+
+float QuadEncoder::getRadPerSec() {
+  return _velocity * 6.2831853 / _countsPerRev;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file QuadEncoder.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Interrupt-Driven Quadrature Encoder Driver.
+ * Counts every A/B edge (4x decoding) in ISRs and estimates velocity
+ * adaptively: period (1/T) at low speed, edge counting at high speed.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef QUAD_ENCODER_H
+#define QUAD_ENCODER_H
+
+#include <Arduino.h>
+#include "FastPin.h"
+
+#define ENCODER_MAX_COUNT 4 // Max encoders attached at the same time
+
+/**
+ * @brief Quadrature encoder on two interrupt-capable pins.
+ *
+ * The ISR is a table lookup: (previous AB << 2 | current AB) indexes a
+ * 16-entry table of -1/0/+1, so there is no branching on direction and
+ * invalid (skipped) transitions count as 0. Each edge also stores its
+ * timestamp, which gives the period for low-speed estimation.
+ *
+ * update() takes an atomic snapshot of the ISR state and picks the
+ * estimator:
+ * - Many edges since the last update: (edges) / (time between first and
+ *   last edge). Edge-aligned, so there is no +/-1 count quantization.
+ * - Few edges: 1 / (last edge period), decaying as 1 / (time since the
+ *   last edge) while no new edge arrives, and 0 after the stop timeout.
+ *
+ * Usage Example (20 ms TaskManager task):
+ * QuadEncoder enc(2, 3, 1200); // 1200 counts per wheel revolution
+ * enc.begin();
+ * enc.update();
+ * float rpm = enc.getRPM();
+ */
+class QuadEncoder {
+  private:
+    int _pinA;
+    int _pinB;
+    FastPin _a;                       // Register reads in the ISR
+    FastPin _b;
+    float _countsPerRev;
+
+    // --- Shared with the ISR ---
+    volatile long _count;
+    volatile uint8_t _state;          // Last AB levels (bit1 = A, bit0 = B)
+    volatile int8_t _dir;             // Direction of the last edge
+    volatile unsigned long _edgeTime; // micros() of the last edge
+    volatile unsigned long _period;   // us between the last two edges (0 = unknown)
+
+    // --- Estimator state (main loop only) ---
+    long _prevCount;
+    unsigned long _prevEdgeTime;
+    int _switchEdges;                 // Edge count at which counting takes over
+    unsigned long _stopTimeout;       // us without edges => stopped
+    float _velocity;                  // counts per second
+
+    int _slot;                        // Index in _instances (-1 = not attached)
+
+    static QuadEncoder* _instances[ENCODER_MAX_COUNT];
+    static void isr0();
+    static void isr1();
+    static void isr2();
+    static void isr3();
+
+    void handleEdge();
+    uint8_t readState();
+
+  public:
+    /**
+     * @brief Construct a new Quad Encoder object.
+     * @param pinA Channel A (must support attachInterrupt).
+     * @param pinB Channel B (must support attachInterrupt).
+     * @param countsPerRev Edges per output revolution (4 x CPR x gear ratio).
+     */
+    QuadEncoder(int pinA, int pinB, float countsPerRev = 1.0);
+
+    /**
+     * @brief Configures the pins and attaches the interrupts.
+     * @return true on success, false if all ENCODER_MAX_COUNT slots are used
+     * or a pin has no interrupt.
+     */
+    bool begin();
+
+    /**
+     * @brief Detaches the interrupts and frees the slot.
+     */
+    void end();
+
+    /**
+     * @brief Atomic read of the edge counter.
+     */
+    long getCount();
+
+    /**
+     * @brief Sets the edge counter (e.g. 0 after homing).
+     */
+    void setCount(long count);
+
+    /**
+     * @brief Refreshes the velocity estimate. Call at a steady rate.
+     */
+    void update();
+
+    /**
+     * @brief Edge count since the last update() at which the estimator
+     * switches from period measurement to edge counting (Default: 4).
+     */
+    void setSwitchEdges(int edges);
+
+    /**
+     * @brief Time without edges after which velocity reads 0 (Default: 100 ms).
+     */
+    void setStopTimeout(unsigned long us);
+
+    float getVelocity();     // counts per second
+    float getRPM();          // output revolutions per minute
+    float getRadPerSec();    // output shaft rad/s
+};
+
+#endif
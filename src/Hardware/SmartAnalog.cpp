@@ -2,8 +2,8 @@
  * @file SmartAnalog.cpp
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief Implementation of SmartAnalog class.
- * @version 1.0.0
- * @date 2025-12-31
+ * @version 1.3.1
+ * @date 2026-10-18
  *
  * @copyright Copyright (c) 2025 Furkan
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -20,6 +20,9 @@ SmartAnalog::SmartAnalog(int pin, int filterSize) {
   _hysteresis = 20;   // Default buffer
   _invert = false;
   _state = false;
+  _sampler = NULL;
+  _channel = -1;
+  _watcher = -1;
   
   // Create Filter Dynamically
   _filter = new SignalFilter(filterSize);
@@ -27,11 +30,7 @@ SmartAnalog::SmartAnalog(int pin, int filterSize) {
   // AUTO-DETECT ADC RESOLUTION
   // Robotis OpenCM / STM32 uses 12-bit (0-4095)
   // Standard Arduino uses 10-bit (0-1023)
-  #if defined(__STM32F1__) || defined(ARDUINO_ARCH_STM32) || defined(OPENCM904)
-    _adcResolution = 4095;
-  #else
-    _adcResolution = 1023;
-  #endif
+  _adcResolution = (1L << ANALOG_ADC_BITS) - 1;
 }
 
 SmartAnalog::~SmartAnalog() {
@@ -53,9 +52,55 @@ void SmartAnalog::begin() {
   _filter->begin();
 }
 
+bool SmartAnalog::attach(AnalogSampler& sampler) {
+  int channel = sampler.addChannel(_pin, _filter);
+  if (channel < 0)
+    return false;
+  _sampler = &sampler;
+  _channel = channel;
+  _watcher = sampler.addThreshold(channel, _threshold, _hysteresis, true);
+  return true;
+}
+
+int SmartAnalog::getWatcher() const {
+  return _watcher;
+}
+
+bool SmartAnalog::setOversampling(uint8_t bits) {
+  if (_sampler == NULL)
+    return false;
+  int oldBits = _sampler->getResolution(_channel);
+  _sampler->setOversampling(_channel, bits);
+  _adcResolution = _sampler->getMaxValue(_channel);
+  if (_filter != NULL)
+    _filter->fill(_sampler->getRaw(_channel)); // Old samples are on the old scale
+
+  // Keep the trigger point at the same voltage on the new scale
+  int shift = _sampler->getResolution(_channel) - oldBits;
+  if (shift > 0)
+  {
+    _threshold <<= shift;
+    _hysteresis <<= shift;
+  }
+  else if (shift < 0)
+  {
+    _threshold >>= -shift;
+    _hysteresis >>= -shift;
+  }
+  if (_watcher >= 0)
+    _sampler->setThreshold(_watcher, _threshold, _hysteresis);
+  return true;
+}
+
+long SmartAnalog::getMaxValue() const {
+  return _adcResolution;
+}
+
 void SmartAnalog::setThreshold(int threshold, int hysteresis) {
   _threshold = threshold;
   _hysteresis = hysteresis;
+  if (_watcher >= 0)
+    _sampler->setThreshold(_watcher, threshold, hysteresis);
 }
 
 void SmartAnalog::setInvert(bool invert) {
@@ -63,10 +108,16 @@ void SmartAnalog::setInvert(bool invert) {
 }
 
 int SmartAnalog::readRaw() {
+  if (_sampler != NULL)
+    return _sampler->getRaw(_channel);
   return analogRead(_pin);
 }
 
 int SmartAnalog::readSmooth() {
+  // Attached: the sampler already pushed every sample through _filter
+  if (_sampler != NULL)
+    return _sampler->getValue(_channel);
+
   int raw = analogRead(_pin);
   if (_filter != NULL)
     return _filter->filter(raw);
@@ -87,6 +138,14 @@ int SmartAnalog::readPercentage() {
 
 // Schmitt Trigger Logic implementation
 bool SmartAnalog::isActive() {
+  // Attached: the sampler's watcher already ran the trigger on every sample
+  if (_watcher >= 0)
+  {
+    bool above = _sampler->isAbove(_watcher);
+    _state = _invert ? !above : above;
+    return _state;
+  }
+
   int val = readSmooth();
   
   if (!_invert) {
@@ -3,8 +3,8 @@
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief Intelligent Analog Sensor Driver with Hysteresis & Filtering.
  * Compatible with OpenCM9.04 (INPUT_ANALOG) and Standard Arduino (INPUT).
- * @version 1.0.0
- * @date 2025-12-31
+ * @version 1.3.1
+ * @date 2026-10-18
  *
  * @copyright Copyright (c) 2025 Furkan
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -19,6 +19,7 @@
 #include <Arduino.h>
 // Utilities klasöründeki filtreyi çağırıyoruz
 #include "../Utils/SignalFilter.h"
+#include "AnalogSampler.h"
 
 /**
  * @brief Wrapper for Analog Sensors (LDR, Potentiometer, Distance).
@@ -26,6 +27,7 @@
  * - Automatic ADC resolution detection (10-bit vs 12-bit).
  * - Moving Average Filtering (Noise reduction).
  * - Schmitt Trigger (Hysteresis) for digital conversions.
+ * - Optional background sampling (attach()): getters never touch the ADC.
  */
 class SmartAnalog {
   private:
@@ -34,8 +36,11 @@ class SmartAnalog {
     int _hysteresis;    // Dead zone buffer
     bool _state;        // Current logical state (Active/Inactive)
     bool _invert;       // Logic inversion flag
-    int _adcResolution; // 1023 (AVR) or 4095 (STM32)
+    long _adcResolution; // 1023 (AVR), 4095 (STM32) or more when oversampled
     SignalFilter* _filter; // Pointer to filter object
+    AnalogSampler* _sampler; // Background sampler (NULL = read on demand)
+    int _channel;            // Channel in _sampler
+    int _watcher;            // Sampler threshold watcher (-1 = none)
 
   public:
     /**
@@ -55,6 +60,39 @@ class SmartAnalog {
      * Automatically selects INPUT_ANALOG for STM32 or INPUT for Arduino.
      */
     void begin();
+
+    /**
+     * @brief Hands sampling over to a background AnalogSampler.
+     * The sampler feeds this sensor's filter at its own rate; readRaw(),
+     * readSmooth(), readPercentage() and isActive() then only read the
+     * latest sample. Call after begin().
+     * The threshold also becomes a sampler watcher: the Schmitt trigger
+     * then runs on every sample and its crossings are queued as events
+     * (ANALOG_EVENT_RISE / FALL, watcher id from getWatcher()).
+     * @return true if the sampler had a free channel.
+     */
+    bool attach(AnalogSampler& sampler);
+
+    /**
+     * @brief Id of this sensor's threshold watcher in the sampler
+     * (-1 if not attached or no watcher was free).
+     */
+    int getWatcher() const;
+
+    /**
+     * @brief Oversamples this sensor's sampler channel for extra bits
+     * (see AnalogSampler::setOversampling()). readRaw() / readSmooth()
+     * and the threshold then use the wider scale (getMaxValue()). The
+     * threshold and hysteresis already set are rescaled with it, so the
+     * trigger point stays at the same voltage.
+     * @return true if attached (on-demand reads are never oversampled).
+     */
+    bool setOversampling(uint8_t bits);
+
+    /**
+     * @brief Full-scale reading (1023, 4095, or wider when oversampled).
+     */
+    long getMaxValue() const;
     
     /**
      * @brief Configures the switching logic.
@@ -71,7 +109,8 @@ class SmartAnalog {
     void setInvert(bool invert);
     
     /**
-     * @brief Reads raw ADC value directly from hardware.
+     * @brief Reads raw ADC value directly from hardware
+     * (latest unfiltered sample when attached).
      */
     int readRaw();
 
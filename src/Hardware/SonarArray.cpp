@@ -0,0 +1,296 @@
+/**
+ * @file SonarArray.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of SonarArray.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "SonarArray.h"
+
+SonarArray::SonarArray() {
+  int i;
+
+  _count = 0;
+  _groups = 0;
+  _current = 0;
+  _listening = false;
+  _groupEnd = 0;
+  _rest = 60000UL;
+  _guard = 2000UL;
+  _medianSize = 3;
+  _front = 0;
+  _cycles = 0;
+
+  i = 0;
+  while (i < SONAR_ARRAY_MAX)
+  {
+    _sonars[i] = NULL;
+    _group[i] = 0;
+    _lastPing[i] = 0;
+    _fill[i] = 0;
+    _head[i] = 0;
+    _filtered[i] = -1.0;
+    _valid[i] = false;
+    _snapshot[0][i] = -1.0;
+    _snapshot[1][i] = -1.0;
+    _snapStatus[0][i] = SONAR_STATUS_NONE;
+    _snapStatus[1][i] = SONAR_STATUS_NONE;
+    i++;
+  }
+}
+
+int SonarArray::add(AsyncSonar& sonar, int group) {
+  if (_count >= SONAR_ARRAY_MAX)
+    return -1;
+  if (group < 0 || group >= SONAR_ARRAY_MAX)
+    group = _count;
+
+  _sonars[_count] = &sonar;
+  _group[_count] = (uint8_t)group;
+  if (group + 1 > _groups)
+    _groups = (uint8_t)(group + 1);
+  _count++;
+  return _count - 1;
+}
+
+void SonarArray::begin() {
+  unsigned long now = micros();
+  int i;
+
+  i = 0;
+  while (i < _count)
+  {
+    _sonars[i]->begin();
+    _lastPing[i] = now - _rest; // Everyone may ping at once
+    i++;
+  }
+  _groupEnd = now - _guard;
+}
+
+void SonarArray::setRestInterval(unsigned long us) {
+  _rest = us;
+}
+
+void SonarArray::setGuardTime(unsigned long us) {
+  _guard = us;
+}
+
+void SonarArray::setMedian(uint8_t size) {
+  if (size < 1)
+    size = 1;
+  if (size > SONAR_MEDIAN_MAX)
+    size = SONAR_MEDIAN_MAX;
+  _medianSize = size;
+
+  int i = 0;
+  while (i < SONAR_ARRAY_MAX)
+  {
+    _fill[i] = 0;
+    _head[i] = 0;
+    i++;
+  }
+}
+
+void SonarArray::setTemperature(float celsius) {
+  int i = 0;
+  while (i < _count)
+  {
+    _sonars[i]->setTemperature(celsius);
+    i++;
+  }
+}
+
+/**
+ * @brief A group may start when every member has rested.
+ */
+bool SonarArray::groupReady(uint8_t group, unsigned long now) {
+  int i = 0;
+  while (i < _count)
+  {
+    if (_group[i] == group && now - _lastPing[i] < _rest)
+      return false;
+    i++;
+  }
+  return true;
+}
+
+void SonarArray::startGroup(uint8_t group, unsigned long now) {
+  int i = 0;
+  while (i < _count)
+  {
+    if (_group[i] == group)
+    {
+      _sonars[i]->startMeasure();
+      _lastPing[i] = now;
+    }
+    i++;
+  }
+  _listening = true;
+}
+
+/**
+ * @brief Median of the last N valid readings (insertion sort, N <= 7).
+ */
+void SonarArray::record(int index) {
+  AsyncSonar* s = _sonars[index];
+  if (s->getStatus() != SONAR_STATUS_OK)
+  {
+    _valid[index] = false;
+    return;
+  }
+
+  _window[index][_head[index]] = s->getDistance();
+  _head[index] = (uint8_t)((_head[index] + 1) % _medianSize);
+  if (_fill[index] < _medianSize)
+    _fill[index]++;
+
+  float sorted[SONAR_MEDIAN_MAX];
+  uint8_t n = _fill[index];
+  uint8_t i, j;
+
+  i = 0;
+  while (i < n)
+  {
+    float v = _window[index][i];
+    j = i;
+    while (j > 0 && sorted[j - 1] > v)
+    {
+      sorted[j] = sorted[j - 1];
+      j--;
+    }
+    sorted[j] = v;
+    i++;
+  }
+  _filtered[index] = sorted[n / 2];
+  _valid[index] = true;
+}
+
+/**
+ * @brief Fills the back buffer, then flips: readers switch in one store.
+ */
+void SonarArray::publish() {
+  uint8_t back = _front ^ 1;
+  int i = 0;
+
+  while (i < _count)
+  {
+    _snapshot[back][i] = _filtered[i];
+    _snapStatus[back][i] = (uint8_t)_sonars[i]->getStatus();
+    i++;
+  }
+  _cycles++;
+  _front = back;
+}
+
+void SonarArray::update() {
+  unsigned long now = micros();
+  int i;
+
+  if (_count == 0)
+    return;
+
+  // 1. Drive the sensors of the group in flight
+  if (_listening)
+  {
+    bool busy = false;
+    i = 0;
+    while (i < _count)
+    {
+      if (_group[i] == _current)
+      {
+        _sonars[i]->update();
+        busy = busy || _sonars[i]->isBusy();
+      }
+      i++;
+    }
+    if (busy)
+      return;
+
+    // Group done: filter its readings, move on
+    i = 0;
+    while (i < _count)
+    {
+      if (_group[i] == _current)
+        record(i);
+      i++;
+    }
+    _listening = false;
+    _groupEnd = micros();
+    _current++;
+    if (_current >= _groups)
+    {
+      _current = 0;
+      publish();
+    }
+    return;
+  }
+
+  // 2. Skip empty group ids
+  uint8_t tries = 0;
+  while (tries < _groups)
+  {
+    i = 0;
+    while (i < _count && _group[i] != _current)
+      i++;
+    if (i < _count)
+      break;
+    _current = (uint8_t)((_current + 1) % _groups);
+    tries++;
+  }
+
+  // 3. Start the next group once the air is quiet and its sensors rested
+  if (now - _groupEnd >= _guard && groupReady(_current, now))
+  {
+    startGroup(_current, now);
+    // Run the trigger phase right away
+    i = 0;
+    while (i < _count)
+    {
+      if (_group[i] == _current)
+        _sonars[i]->update();
+      i++;
+    }
+  }
+}
+
+float SonarArray::getDistance(int index) {
+  if (index < 0 || index >= _count || !_valid[index])
+    return -1.0;
+  return _filtered[index];
+}
+
+unsigned long SonarArray::getSnapshot(float* ranges, int maxCount) {
+  // Copy from the front buffer; re-read if a publish() flipped it meanwhile
+  // (only possible when called from an interrupt context)
+  uint8_t front;
+  unsigned long cycle;
+  int i;
+
+  do
+  {
+    front = _front;
+    cycle = _cycles;
+    i = 0;
+    while (i < _count && i < maxCount)
+    {
+      ranges[i] = (_snapStatus[front][i] == SONAR_STATUS_OK) ? _snapshot[front][i] : -1.0;
+      i++;
+    }
+  } while (front != _front);
+  return cycle;
+}
+
+unsigned long SonarArray::getCycleCount() {
+  return _cycles;
+}
+
+int SonarArray::getCount() {
+  return _count;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file SonarArray.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Multi-Sonar Scheduler (Crosstalk-Free Staggering, Median Ranging).
+ * Pings groups of AsyncSonars in turn so that no two interfering sensors
+ * are ever listening at the same time.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef SONAR_ARRAY_H
+#define SONAR_ARRAY_H
+
+#include <Arduino.h>
+#include "AsyncSonar.h"
+
+#define SONAR_ARRAY_MAX  8 // Sensors per array
+#define SONAR_MEDIAN_MAX 7 // Max median window
+
+/**
+ * @brief Schedules up to SONAR_ARRAY_MAX sonars.
+ *
+ * Every sensor belongs to a group. Sensors in the same group are
+ * triggered together (pick ones that cannot hear each other, e.g. front
+ * and back). Groups are pinged round-robin: the next group starts as soon
+ * as the previous one has finished listening plus a guard time for stray
+ * echoes, and each of its sensors has rested for the rest interval. With
+ * every sensor in its own group (the default) this is plain round-robin.
+ *
+ * Each valid reading goes through a per-sensor median-of-N filter. When
+ * the last group of a cycle finishes, all filtered ranges are published
+ * at once into a second buffer, so getSnapshot() always returns ranges
+ * from the same cycle, never a mix of old and new.
+ *
+ * Usage Example:
+ * AsyncSonar front(2, 3), back(4, 5), left(6, 7), right(8, 9);
+ * SonarArray sonars;
+ * sonars.add(front, 0); sonars.add(back, 0); // Opposite: ping together
+ * sonars.add(left, 1);  sonars.add(right, 1);
+ * sonars.begin();
+ * // loop(): sonars.update();
+ */
+class SonarArray {
+  private:
+    AsyncSonar* _sonars[SONAR_ARRAY_MAX];
+    uint8_t _group[SONAR_ARRAY_MAX];
+    unsigned long _lastPing[SONAR_ARRAY_MAX]; // micros() of each sensor's last trigger
+    int _count;
+    uint8_t _groups;          // Highest group id + 1
+    uint8_t _current;         // Group being pinged or next to ping
+    bool _listening;          // _current group is in flight
+    unsigned long _groupEnd;  // micros() when the last group finished
+    unsigned long _rest;      // Min us between two pings of one sensor
+    unsigned long _guard;     // Quiet us between groups
+
+    // --- Median filter ---
+    float _window[SONAR_ARRAY_MAX][SONAR_MEDIAN_MAX];
+    uint8_t _fill[SONAR_ARRAY_MAX];
+    uint8_t _head[SONAR_ARRAY_MAX];
+    uint8_t _medianSize;
+    float _filtered[SONAR_ARRAY_MAX];
+    bool _valid[SONAR_ARRAY_MAX];
+
+    // --- Double-buffered snapshot ---
+    float _snapshot[2][SONAR_ARRAY_MAX];
+    uint8_t _snapStatus[2][SONAR_ARRAY_MAX];
+    volatile uint8_t _front;  // Buffer readers see
+    unsigned long _cycles;    // Completed cycles
+
+    bool groupReady(uint8_t group, unsigned long now);
+    void startGroup(uint8_t group, unsigned long now);
+    void record(int index);
+    void publish();
+
+  public:
+    SonarArray();
+
+    /**
+     * @brief Adds a sonar to the array.
+     * @param sonar The sensor (must outlive the array).
+     * @param group Ping group (0..SONAR_ARRAY_MAX-1). Default: a group of its own.
+     * @return int Index of the sensor, or -1 if the array is full.
+     */
+    int add(AsyncSonar& sonar, int group = -1);
+
+    /**
+     * @brief Calls begin() on every sonar.
+     */
+    void begin();
+
+    /**
+     * @brief Runs the scheduler. Call as often as possible (non-blocking
+     * when the sonars use the interrupt echo path).
+     */
+    void update();
+
+    /**
+     * @brief Min time between two pings of the same sensor (Default: 60000 us,
+     * the HC-SR04 recommended cycle).
+     */
+    void setRestInterval(unsigned long us);
+
+    /**
+     * @brief Quiet time after a group before the next one (Default: 2000 us).
+     */
+    void setGuardTime(unsigned long us);
+
+    /**
+     * @brief Median window per sensor (1 = off, odd, max SONAR_MEDIAN_MAX).
+     */
+    void setMedian(uint8_t size);
+
+    /**
+     * @brief Forwards the air temperature to every sonar (speed of sound).
+     */
+    void setTemperature(float celsius);
+
+    /**
+     * @brief Latest filtered distance of one sensor in cm (-1 if none yet).
+     */
+    float getDistance(int index);
+
+    /**
+     * @brief Copies the ranges of the last complete cycle.
+     * @param ranges Output, one cm value per sensor (-1 = no valid reading).
+     * @param maxCount Size of ranges.
+     * @return unsigned long Cycle number of the snapshot (0 = none yet).
+     */
+    unsigned long getSnapshot(float* ranges, int maxCount);
+
+    /**
+     * @brief Completed ping cycles (all groups once).
+     */
+    unsigned long getCycleCount();
+
+    int getCount();
+};
+
+#endif
@@ -4,8 +4,8 @@
  * @brief Master Include File for RobotisTools Framework.
  *
  * This single header includes the entire ecosystem:
- * - Core Kernel (App, TaskManager, CLI, Logger)
- * - Hardware Drivers (Button, LED, Sonar, Battery, SmartAnalog)
+ * - Core Kernel (App, Callback, TickClock, TaskManager, TimerWheel, CLI, Logger)
+ * - Hardware Drivers (Button, ButtonGroup, LED, LedSequencer, Sonar, Battery, SmartAnalog)
  * - Utilities (PID, Filters, Timers, DiffDrive, ConfigStore)
  *
  * @version 6.0.0 (Control Systems Edition)
@@ -35,27 +35,43 @@
 
 #include "Utils/SimpleTimer.h"   // Zamanlama
 #include "Utils/SignalFilter.h"  // Gürültü Filtreleme
+#include "Utils/WindowStats.h"   // Pencere İstatistikleri (Min/Max/Varyans/Eğim)
+#include "Utils/FixedPoint.h"    // Sabit Noktalı Aritmetik (Q16.16)
+#include "Utils/FixedTrig.h"     // Tablo Tabanlı Sin/Cos (İkili Açı)
 #include "Utils/FastPID.h"       // Kontrol Teorisi
+#include "Utils/MultiPID.h"      // Çok Eksenli PID (Toplu Hesaplama)
+#include "Utils/MotionProfile.h" // İvme/Jerk Sınırlı Hareket Profilleri
 #include "Utils/DiffDrive.h"     // Robot Sürüş Matematiği
+#include "Utils/Odometry.h"      // Konum Tahmini (x, y, θ)
 #include "Utils/ConfigStore.h"   // EEPROM Hafıza Yönetimi (Template)
+#include "Utils/ParamStore.h"    // Anahtar-Değer Parametre Deposu (Log Yapılı)
 
 // -------------------------------------------------------------
 // 2. HARDWARE DRIVERS (Donanım Sürücüleri)
 // -------------------------------------------------------------
 // Fiziksel bileşenleri kontrol eden sınıflar.
 
+#include "Hardware/FastPin.h"        // Doğrudan Register Pin Erişimi
 #include "Hardware/Button.h"         // Akıllı Buton
+#include "Hardware/ButtonGroup.h"    // Paralel Buton Tarama (Dikey Sayaç)
 #include "Hardware/Led.h"            // Akıllı LED
+#include "Hardware/LedSequencer.h"   // LED Sıralayıcı (Yazılımsal PWM)
+#include "Hardware/AnalogSampler.h"  // Arka Plan ADC Örnekleme
 #include "Hardware/SmartAnalog.h"    // Histerezisli Sensör
 #include "Hardware/BatteryMonitor.h" // Pil Takibi
 #include "Hardware/AsyncSonar.h"     // Bloklamayan Ultrasonik
+#include "Hardware/SonarArray.h"     // Çoklu Sonar Zamanlayıcı (Medyan)
+#include "Hardware/QuadEncoder.h"    // Kesmeli Enkoder (Hız Tahmini)
 
 // -------------------------------------------------------------
 // 3. CORE SYSTEM (İşletim Sistemi Çekirdeği)
 // -------------------------------------------------------------
 // Sistemin beyni. En son eklenir.
 
+#include "Core/Delegate.h"        // Geri Çağırma (Üye Fonksiyon / Lambda)
+#include "Core/TickClock.h"       // Ortak Zaman Damgası (64-bit)
 #include "Core/TaskManager.h"     // Görev Yöneticisi
+#include "Core/TimerWheel.h"      // Zamanlayıcı Çarkı (Zaman Aşımı)
 #include "Core/SerialCommander.h" // Seri Komut İşleyici
 #include "Core/Logger.h"          // Loglama Sistemi
 #include "Core/RobotisApp.h"      // [PATRON] Tüm sistemi yöneten Kernel
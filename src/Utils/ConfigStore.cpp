@@ -0,0 +1,291 @@
+/**
+ * @file ConfigStore.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of the ConfigStore write-behind engine and slot layout.
+ * @version 1.2.3
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "ConfigStore.h"
+
+// avr-libc's eeprom_is_ready() is false while a byte is still programming
+// (the host EEPROM provides the same macro). Other cores have no busy
+// flag; a build flag may supply one (see ConfigStoreBase)
+#if defined(__AVR__)
+  #include <avr/eeprom.h>
+#endif
+#if !defined(CONFIG_EEPROM_READY)
+  #if defined(eeprom_is_ready)
+    #define CONFIG_EEPROM_READY() eeprom_is_ready()
+  #else
+    #define CONFIG_EEPROM_READY() true
+  #endif
+#endif
+
+// Header byte offsets inside a slot (little-endian fields)
+#define HDR_MAGIC    0
+#define HDR_VERSION  2
+#define HDR_SEQUENCE 4
+#define HDR_CRC      8
+
+ConfigStoreBase::ConfigStoreBase(void* bytes, int size, int address, uint8_t slots, uint16_t version) {
+  _bytes = (uint8_t*)bytes;
+  _size = size;
+  _address = address;
+  _cursor = 0;
+  _pending = false;
+
+  _slots = (slots == 1) ? 2 : slots;
+  if (_slots > CONFIG_MAX_SLOTS)
+    _slots = CONFIG_MAX_SLOTS;
+  _version = version;
+  _sequence = 0;
+  _valid = (_slots == 0);
+  // Nothing valid yet: the first save goes to slot 0
+  _active = (_slots > 0) ? _slots - 1 : 0;
+  _target = 0;
+  memset(_header, 0, sizeof(_header));
+}
+
+uint16_t ConfigStoreBase::crc16(uint16_t crc, const uint8_t* data, int length) {
+  int i;
+  uint8_t bit;
+
+  i = 0;
+  while (i < length)
+  {
+    crc ^= (uint16_t)data[i] << 8;
+    bit = 0;
+    while (bit < 8)
+    {
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+      bit++;
+    }
+    i++;
+  }
+  return crc;
+}
+
+int ConfigStoreBase::slotAddress(uint8_t slot) {
+  return _address + (int)slot * (CONFIG_HEADER_SIZE + _size);
+}
+
+int ConfigStoreBase::footprint() {
+  return (_slots == 0) ? _size : (int)_slots * (CONFIG_HEADER_SIZE + _size);
+}
+
+/**
+ * @brief Total positions in the write stream.
+ * Legacy: payload. Slots: payload + header body(8) + magic(2).
+ */
+int ConfigStoreBase::streamLength() {
+  return (_slots == 0) ? _size : _size + CONFIG_HEADER_SIZE;
+}
+
+/**
+ * @brief Maps a stream position to its EEPROM address and wanted value.
+ * The stream order is what makes a slot commit power-loss safe.
+ */
+uint8_t ConfigStoreBase::streamByte(int pos, int* addr) {
+  if (_slots == 0)
+  {
+    *addr = _address + pos;
+    return _bytes[pos];
+  }
+
+  int base = slotAddress(_target);
+  // 1. Payload. An older copy in the target keeps its magic, but its CRC
+  // no longer matches, so load() skips it until the new header is done.
+  if (pos < _size)
+  {
+    *addr = base + CONFIG_HEADER_SIZE + pos;
+    return _bytes[pos];
+  }
+  pos -= _size;
+  // 2. Version, sequence, CRC (the last CRC byte commits a reused slot)
+  if (pos < CONFIG_HEADER_SIZE - 2)
+  {
+    *addr = base + HDR_VERSION + pos;
+    return _header[HDR_VERSION + pos];
+  }
+  // 3. Magic: high byte, then the low byte last (commits a fresh slot)
+  pos -= CONFIG_HEADER_SIZE - 2;
+  *addr = base + HDR_MAGIC + 1 - pos;
+  return _header[HDR_MAGIC + 1 - pos];
+}
+
+void ConfigStoreBase::saveAsync() {
+  if (_slots > 0)
+  {
+    // Stage the header for the slot after the newest valid one. If a save
+    // is already running, the same target is simply rewritten.
+    uint32_t seq = _sequence + 1;
+    _target = (uint8_t)((_active + 1) % _slots);
+    _header[HDR_MAGIC] = (uint8_t)(CONFIG_MAGIC & 0xFF);
+    _header[HDR_MAGIC + 1] = (uint8_t)(CONFIG_MAGIC >> 8);
+    _header[HDR_VERSION] = (uint8_t)(_version & 0xFF);
+    _header[HDR_VERSION + 1] = (uint8_t)(_version >> 8);
+    _header[HDR_SEQUENCE] = (uint8_t)(seq & 0xFF);
+    _header[HDR_SEQUENCE + 1] = (uint8_t)(seq >> 8);
+    _header[HDR_SEQUENCE + 2] = (uint8_t)(seq >> 16);
+    _header[HDR_SEQUENCE + 3] = (uint8_t)(seq >> 24);
+    uint16_t crc = crc16(0xFFFF, &_header[HDR_VERSION], 6);
+    crc = crc16(crc, _bytes, _size);
+    _header[HDR_CRC] = (uint8_t)(crc & 0xFF);
+    _header[HDR_CRC + 1] = (uint8_t)(crc >> 8);
+  }
+  // Restart from 0: bytes behind the cursor may have changed again
+  _cursor = 0;
+  _pending = true;
+}
+
+/**
+ * @brief Compare-then-write, bounded in both reads and writes.
+ * @param wait false: stop as soon as the EEPROM is busy (any access would
+ * busy-wait for the byte in progress). true: let accesses wait (flush).
+ */
+int ConfigStoreBase::advance(int budget, bool wait) {
+  int written = 0;
+  int scanned = 0;
+  int length = streamLength();
+  int addr;
+
+  while (_pending && written < budget && scanned < CONFIG_SCAN_LIMIT)
+  {
+    if (!wait && !CONFIG_EEPROM_READY())
+      break;
+    uint8_t value = streamByte(_cursor, &addr);
+    if (EEPROM.read(addr) != value)
+    {
+      EEPROM.write(addr, value);
+      written++;
+    }
+    scanned++;
+    _cursor++;
+    if (_cursor >= length)
+    {
+      _pending = false;
+      if (_slots > 0)
+      {
+        // Committed: the new copy is now the newest valid one
+        _active = _target;
+        _sequence++;
+        _valid = true;
+      }
+    }
+  }
+  return written;
+}
+
+int ConfigStoreBase::service(int budget) {
+  return advance(budget, false);
+}
+
+void ConfigStoreBase::flush() {
+  while (_pending)
+    advance(streamLength(), true);
+}
+
+bool ConfigStoreBase::isPending() {
+  return _pending;
+}
+
+int ConfigStoreBase::pendingBytes() {
+  return _pending ? (streamLength() - _cursor) : 0;
+}
+
+bool ConfigStoreBase::isValid() {
+  return _valid;
+}
+
+/**
+ * @brief Header check of one slot: magic, version. Returns its sequence.
+ */
+bool ConfigStoreBase::readSlot(uint8_t slot, uint32_t* sequence) {
+  int base = slotAddress(slot);
+  uint16_t magic = EEPROM.read(base + HDR_MAGIC) | ((uint16_t)EEPROM.read(base + HDR_MAGIC + 1) << 8);
+  uint16_t version = EEPROM.read(base + HDR_VERSION) | ((uint16_t)EEPROM.read(base + HDR_VERSION + 1) << 8);
+
+  if (magic != CONFIG_MAGIC || version != _version)
+    return false;
+  *sequence = (uint32_t)EEPROM.read(base + HDR_SEQUENCE)
+            | ((uint32_t)EEPROM.read(base + HDR_SEQUENCE + 1) << 8)
+            | ((uint32_t)EEPROM.read(base + HDR_SEQUENCE + 2) << 16)
+            | ((uint32_t)EEPROM.read(base + HDR_SEQUENCE + 3) << 24);
+  return true;
+}
+
+/**
+ * @brief Boot validation. Only the (few) headers are scanned; the payload
+ * CRC is checked for the newest candidate, then the next newest, etc.
+ * On success the payload is already in RAM.
+ */
+bool ConfigStoreBase::loadBytes() {
+  uint32_t seq[CONFIG_MAX_SLOTS];
+  bool ok[CONFIG_MAX_SLOTS];
+  uint8_t n = _slots;
+  uint8_t i;
+  int k;
+
+  _pending = false;
+  i = 0;
+  while (i < n)
+  {
+    ok[i] = readSlot(i, &seq[i]);
+    i++;
+  }
+
+  for (;;)
+  {
+    // Newest remaining candidate (wrap-safe sequence compare)
+    int best = -1;
+    i = 0;
+    while (i < n)
+    {
+      if (ok[i] && (best < 0 || (int32_t)(seq[i] - seq[best]) > 0))
+        best = i;
+      i++;
+    }
+    if (best < 0)
+      break;
+
+    int base = slotAddress((uint8_t)best);
+    uint8_t head[6];
+    k = 0;
+    while (k < 6)
+    {
+      head[k] = EEPROM.read(base + HDR_VERSION + k);
+      k++;
+    }
+    uint16_t crc = crc16(0xFFFF, head, 6);
+    k = 0;
+    while (k < _size)
+    {
+      _bytes[k] = EEPROM.read(base + CONFIG_HEADER_SIZE + k);
+      k++;
+    }
+    crc = crc16(crc, _bytes, _size);
+    uint16_t stored = EEPROM.read(base + HDR_CRC) | ((uint16_t)EEPROM.read(base + HDR_CRC + 1) << 8);
+
+    if (crc == stored)
+    {
+      _active = (uint8_t)best;
+      _sequence = seq[best];
+      _valid = true;
+      return true;
+    }
+    ok[best] = false; // Torn or corrupted: try the previous copy
+  }
+
+  // Nothing valid: next save starts at slot 0 with sequence 1
+  _active = _slots - 1;
+  _sequence = 0;
+  _valid = false;
+  return false;
+}
@@ -3,8 +3,10 @@
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief EEPROM Manager using C++ Templates.
  * Allows saving/loading complex data structures (structs) easily.
- * @version 1.0.0
- * @date 2025-12-30
+ * Supports write-behind saving that never stalls the main loop, and an
+ * optional wear-leveled, CRC-validated slot layout.
+ * @version 1.2.3
+ * @date 2026-10-18
  *
  * @copyright Copyright (c) 2025 Furkan
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -19,48 +21,198 @@
 #include <Arduino.h>
 #include <EEPROM.h>
 
+#define CONFIG_SCAN_LIMIT 32   // Max bytes compared per service() call
+
+#define CONFIG_MAGIC 0x5243    // "RC" (Robotis Config)
+#define CONFIG_HEADER_SIZE 10  // magic(2) version(2) sequence(4) crc(2)
+#define CONFIG_MAX_SLOTS 8
+
+/**
+ * @brief Type-independent part of ConfigStore: the write-behind engine.
+ * Works on the raw bytes of the RAM copy, so RobotisApp can service any
+ * ConfigStore<T> through one pointer type.
+ *
+ * saveAsync() only marks the RAM copy dirty. Each service(budget) call
+ * then compares at most CONFIG_SCAN_LIMIT bytes against EEPROM and writes
+ * at most `budget` of the ones that differ. On AVR one EEPROM byte takes
+ * ~3.3 ms to program and every EEPROM access, read or write, busy-waits
+ * until the previous byte is done. service() therefore returns at once
+ * while the EEPROM is busy (eeprom_is_ready()) and stops after a write,
+ * so a tick never waits for the EEPROM: on AVR a save advances by at most
+ * one byte per ~3.3 ms, whatever the budget.
+ *
+ * Other cores have no busy flag: service() writes up to `budget` bytes per
+ * call, and each costs whatever the core's EEPROM.write() costs. Only
+ * the number of writes per tick is bounded, not their duration. On STM32
+ * (OpenCM 9.04 included) EEPROM is emulated in flash, and a byte write
+ * can erase and reprogram a flash page, stalling the CPU for milliseconds
+ * (tens of ms on F1 parts). The stall cannot be split from here. Keep the
+ * budget at 1 and save while a stall is harmless (e.g. motors stopped).
+ * A core with a busy flag can pass it as a build flag, e.g.
+ * -D'CONFIG_EEPROM_READY()=myEepromIdle()'.
+ *
+ * Slot layout (slots >= 2): the region holds `slots` copies, each
+ * [magic | version | sequence | crc | payload]. A save goes to the slot
+ * after the newest one, so writes rotate over all slots (wear leveling)
+ * and the previous copy stays intact until the new one is complete.
+ * Write order is: payload, version / sequence / CRC, magic last. Until
+ * the CRC is complete, the target slot's CRC does not match its contents
+ * (and a fresh slot has no magic yet), so losing power at any byte leaves
+ * the old copy as the newest valid one; after it, the new copy. Never a
+ * mix. No cell is written more than once per save of its slot (the
+ * sequence low byte and the CRC change every time), so a store lasts
+ * about endurance * slots saves.
+ */
+class ConfigStoreBase {
+  protected:
+    uint8_t* _bytes;   // RAM copy (the derived class owns the storage)
+    int _size;         // Bytes in the RAM copy
+    int _address;      // EEPROM start address
+    int _cursor;       // Next position in the write stream
+    bool _pending;     // A save is in progress
+
+    // --- Slot layout (unused when _slots == 0) ---
+    uint8_t _slots;    // Number of slots, 0 = legacy raw layout
+    uint8_t _active;   // Slot holding the newest valid copy
+    uint8_t _target;   // Slot being written
+    uint16_t _version; // User layout version, bump when T changes
+    uint32_t _sequence; // Sequence of the newest valid copy
+    bool _valid;       // load() found a valid copy
+    uint8_t _header[CONFIG_HEADER_SIZE]; // Header staged for _target
+
+    ConfigStoreBase(void* bytes, int size, int address, uint8_t slots, uint16_t version);
+
+    int slotAddress(uint8_t slot);
+    int streamLength();
+    uint8_t streamByte(int pos, int* addr);
+    int advance(int budget, bool wait);
+    bool readSlot(uint8_t slot, uint32_t* sequence);
+    bool loadBytes();
+
+  public:
+    /**
+     * @brief Starts (or restarts) writing the RAM copy to EEPROM in the
+     * background. Returns immediately.
+     */
+    void saveAsync();
+
+    /**
+     * @brief Advances a pending save without waiting for the EEPROM.
+     * Returns immediately while a previous byte is still programming.
+     * @param budget Max EEPROM bytes to write in this call.
+     * @return int Bytes actually written.
+     */
+    int service(int budget);
+
+    /**
+     * @brief Blocks until the pending save is complete (waits for every byte).
+     */
+    void flush();
+
+    /**
+     * @brief True while a save has not reached EEPROM completely.
+     */
+    bool isPending();
+
+    /**
+     * @brief Bytes not yet verified/written (upper bound for the remaining writes).
+     */
+    int pendingBytes();
+
+    /**
+     * @brief True if the last load() found a valid copy. Always true in
+     * the legacy layout (there is nothing to validate).
+     */
+    bool isValid();
+
+    /**
+     * @brief EEPROM bytes used by this store (to place the next one after it).
+     */
+    int footprint();
+
+    /**
+     * @brief CRC-16/CCITT-FALSE, continued from `crc` (start with 0xFFFF).
+     */
+    static uint16_t crc16(uint16_t crc, const uint8_t* data, int length);
+};
+
 /**
  * @brief A generic class to store any type of data (int, float, struct) in EEPROM.
  * * Usage Example:
  * struct Settings { int speed; float kp; };
  * ConfigStore<Settings> memory(0, {100, 1.5});
+ * app.addConfig(memory);        // RobotisApp services background saves
+ * memory.saveAsync(newSettings); // Returns at once, written a byte per tick
+ *
+ * Wear-leveled and validated (2 slots = A/B, more slots = more wear spread):
+ * ConfigStore<Settings> memory(0, {100, 1.5}, 4, 1); // 4 slots, layout v1
+ * memory.load(); // Newest valid copy, or the defaults if none is valid
  * * @tparam T The data type to store (can be a custom struct).
  */
 template <class T>
-class ConfigStore {
+class ConfigStore : public ConfigStoreBase {
   private:
-    int _address; // EEPROM start address
     T _data;      // RAM copy of the data
+    T _defaults;  // Factory values
 
   public:
     /**
      * @brief Construct a new Config Store object.
      * * @param address EEPROM address to start writing/reading.
      * @param defaultData Default values to use if EEPROM is empty or manual reset.
+     * @param slots 0 = legacy raw struct at address (no header), 2+ = rotating
+     * CRC-checked slots taking slots * (10 + sizeof(T)) bytes. 1 is treated as 2,
+     * more than CONFIG_MAX_SLOTS as CONFIG_MAX_SLOTS.
+     * @param version Layout version stored in the header. A mismatch on
+     * load() falls back to the defaults.
      */
-    ConfigStore(int address, T defaultData) {
-      _address = address;
+    ConfigStore(int address, T defaultData, uint8_t slots = 0, uint16_t version = 0)
+      : ConfigStoreBase(&_data, sizeof(T), address, slots, version) {
       _data = defaultData;
+      _defaults = defaultData;
     }
 
     /**
      * @brief Loads data from EEPROM into RAM.
+     * Cancels a pending background save. With slots, reads only the
+     * headers plus one payload and falls back to the defaults when no
+     * valid copy exists (check isValid()).
      * @return T The data read from memory.
      */
     T load() {
-      EEPROM.get(_address, _data);
+      if (_slots == 0)
+      {
+        _pending = false;
+        EEPROM.get(_address, _data);
+        return _data;
+      }
+      if (!loadBytes())
+        _data = _defaults;
       return _data;
     }
 
     /**
-     * @brief Saves new data to EEPROM and updates RAM.
-     * Uses EEPROM.put() which only writes if data has changed (saves flash life).
+     * @brief Saves new data to EEPROM and updates RAM (blocking).
+     * Only bytes that have changed are written (saves flash life).
      * * @param newData The new data to store.
      */
     void save(T newData) {
       _data = newData;
-      EEPROM.put(_address, _data);
+      saveAsync();
+      flush();
+    }
+
+    /**
+     * @brief Updates RAM immediately and writes EEPROM in the background.
+     * Requires service() calls, e.g. via RobotisApp::addConfig().
+     * * @param newData The new data to store.
+     */
+    void saveAsync(T newData) {
+      _data = newData;
+      ConfigStoreBase::saveAsync();
     }
+
+    using ConfigStoreBase::saveAsync;
     
     /**
      * @brief Returns the current data in RAM without reading from EEPROM.
@@ -72,16 +224,18 @@ class ConfigStore {
     }
 
     /**
-     * @brief Resets the EEPROM data to the default values provided in constructor.
+     * @brief Returns the defaults given to the constructor.
+     */
+    T getDefaults() {
+      return _defaults;
+    }
+
+    /**
+     * @brief Restores the constructor defaults in RAM and EEPROM (blocking).
      */
     void factoryReset() {
-      // _data is already set to default in constructor if we re-instantiate,
-      // but here we might need to store the constructor's default.
-      // Since we don't store "default" separately to save RAM, 
-      // the user should pass the default struct again or handle logic externally.
-      // However, usually save() is enough.
-      // This is a placeholder if advanced reset logic is needed.
+      save(_defaults);
     }
 };
 
-#endif
\ No newline at end of file
+#endif
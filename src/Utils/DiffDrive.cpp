@@ -2,8 +2,8 @@
  * @file DiffDrive.cpp
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief Implementation of DiffDrive kinematics.
- * @version 1.0.0
- * @date 2025-12-30
+ * @version 1.2.0
+ * @date 2026-10-18
  *
  * @copyright Copyright (c) 2025 Furkan
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -14,18 +14,93 @@
 
 #include "DiffDrive.h"
 
+// Reciprocal table for normalization: round(100 * 65536 / mag), mag = 101..200.
+// (|wheel| * table[mag - 101]) >> 8 == (|wheel| * 100 / mag) in Q8, no division.
+static const uint16_t NORMALIZE_RECIPROCAL[100] PROGMEM = {
+  64887, 64251, 63627, 63015, 62415, 61826, 61249, 60681, 60125, 59578,
+  59041, 58514, 57996, 57488, 56988, 56497, 56014, 55539, 55072, 54613,
+  54162, 53718, 53281, 52852, 52429, 52013, 51603, 51200, 50803, 50412,
+  50027, 49648, 49275, 48907, 48545, 48188, 47836, 47490, 47148, 46811,
+  46479, 46152, 45829, 45511, 45197, 44888, 44582, 44281, 43984, 43691,
+  43401, 43116, 42834, 42556, 42281, 42010, 41743, 41478, 41218, 40960,
+  40706, 40454, 40206, 39961, 39719, 39480, 39243, 39010, 38779, 38551,
+  38325, 38102, 37882, 37664, 37449, 37236, 37026, 36818, 36612, 36409,
+  36208, 36009, 35812, 35617, 35425, 35234, 35046, 34860, 34675, 34493,
+  34312, 34133, 33956, 33781, 33608, 33437, 33267, 33099, 32933, 32768
+};
+
 /**
  * @brief Constructor.
  */
 DiffDrive::DiffDrive(int maxPWM) {
   _maxPWM = maxPWM;
   _deadband = 0; // Default: No deadband
+  _expo = 0;     // Default: Linear response
   _leftSpeed = 0;
   _rightSpeed = 0;
+
+  _wheelRadius = 0.0;
+  _trackWidth = 0.0;
+  _maxWheelSpeed = 0.0;
+  _limited = false;
+  _leftVel = 0.0;
+  _rightVel = 0.0;
+
+  // Percent -> PWM factor in Q8, rounded up so 100% lands exactly on maxPWM
+  _pwmScale = ((unsigned long)maxPWM * 256UL + 99UL) / 100UL;
+  buildCurve();
 }
 
 void DiffDrive::setDeadband(int limit) {
-  _deadband = limit;
+  _deadband = constrain(limit, 0, DIFF_DRIVE_INPUT_MAX);
+  buildCurve();
+}
+
+void DiffDrive::setExpo(int percent) {
+  _expo = constrain(percent, 0, 100);
+  buildCurve();
+}
+
+/**
+ * @brief Fills the response LUT. Runs only when the curve changes, so the
+ * long math here never reaches compute().
+ */
+void DiffDrive::buildCurve() {
+  long span = DIFF_DRIVE_INPUT_MAX - _deadband;
+  long i;
+
+  i = 0;
+  while (i <= DIFF_DRIVE_INPUT_MAX)
+  {
+    if (i < _deadband || span <= 0)
+      _curve[i] = 0;
+    else
+    {
+      // 1. Deadband shaping: rescale [deadband..100] -> [0..100]
+      long u = ((i - _deadband) * 100L + span / 2) / span;
+      // 2. Expo: ((100 - e) * u * 100^2 + e * u^3) / 100^3
+      long out = ((100L - _expo) * u * 10000L + (long)_expo * u * u * u + 500000L) / 1000000L;
+      _curve[i] = (uint8_t)out;
+    }
+    i++;
+  }
+}
+
+/**
+ * @brief Clamps to -100..100 and applies the response curve.
+ */
+int DiffDrive::shape(int v) const {
+  if (v >= 0)
+    return _curve[(v > DIFF_DRIVE_INPUT_MAX) ? DIFF_DRIVE_INPUT_MAX : v];
+  return -(int)_curve[(v < -DIFF_DRIVE_INPUT_MAX) ? DIFF_DRIVE_INPUT_MAX : -v];
+}
+
+/**
+ * @brief Q8 percent magnitude (0..25600) to PWM with one multiply and a shift.
+ */
+int DiffDrive::toPWM(unsigned long pctQ8) const {
+  int pwm = (int)((pctQ8 * _pwmScale + 0x8000UL) >> 16);
+  return (pwm > _maxPWM) ? _maxPWM : pwm;
 }
 
 /**
@@ -33,38 +108,39 @@ void DiffDrive::setDeadband(int limit) {
  * Formula: 
  * Left  = Y + X
  * Right = Y - X
- * Then scaled to MaxPWM.
+ * Then normalized by the larger magnitude and scaled to MaxPWM.
  */
 void DiffDrive::compute(int x, int y) {
-  // 1. Apply Deadband (Ignore small joystick drift)
-  if (abs(x) < _deadband) 
-    x = 0;
-  if (abs(y) < _deadband) 
-    y = 0;
-
-  // 2. Raw Mixing
-  // X and Y are expected to be roughly in percentage range (-100 to 100)
+  // 1. Response Curve (Deadband + Expo from the LUT)
+  x = shape(x);
+  y = shape(y);
+
+  // 2. Raw Mixing (-200..200)
   int rawLeft = y + x;
   int rawRight = y - x;
 
-  // 3. Scale and Clip to Max PWM
-  // Input range is roughly -200 to 200 (100+100)
-  // Output range is -_maxPWM to _maxPWM
-  
-  _leftSpeed = map(rawLeft, -200, 200, -_maxPWM, _maxPWM);
-  _rightSpeed = map(rawRight, -200, 200, -_maxPWM, _maxPWM);
-
-  // 4. Hard Limit Safeguard (Constrain)
-  // map() does not constrain values out of range by default
-  if (_leftSpeed > _maxPWM) 
-    _leftSpeed = _maxPWM;
-  if (_leftSpeed < -_maxPWM) 
-    _leftSpeed = -_maxPWM;
-  
-  if (_rightSpeed > _maxPWM) 
-    _rightSpeed = _maxPWM;
-  if (_rightSpeed < -_maxPWM)
-    _rightSpeed = -_maxPWM;
+  // 3. Ratio-Preserving Normalization (magnitudes in Q8 percent)
+  // Instead of clipping each wheel (which bends the arc), divide both
+  // by the larger magnitude when it exceeds full scale.
+  unsigned long absLeft = (rawLeft < 0) ? -rawLeft : rawLeft;
+  unsigned long absRight = (rawRight < 0) ? -rawRight : rawRight;
+  unsigned long mag = (absLeft > absRight) ? absLeft : absRight;
+
+  if (mag > DIFF_DRIVE_INPUT_MAX)
+  {
+    unsigned long recip = pgm_read_word(&NORMALIZE_RECIPROCAL[mag - (DIFF_DRIVE_INPUT_MAX + 1)]);
+    absLeft = (absLeft * recip) >> 8;
+    absRight = (absRight * recip) >> 8;
+  }
+  else
+  {
+    absLeft <<= 8;
+    absRight <<= 8;
+  }
+
+  // 4. Scale to Max PWM
+  _leftSpeed = (rawLeft < 0) ? -toPWM(absLeft) : toPWM(absLeft);
+  _rightSpeed = (rawRight < 0) ? -toPWM(absRight) : toPWM(absRight);
 }
 
 int DiffDrive::getLeft() {
@@ -73,4 +149,95 @@ int DiffDrive::getLeft() {
 
 int DiffDrive::getRight() {
   return _rightSpeed;
-}
\ No newline at end of file
+}
+
+// =============================================================================
+// VELOCITY MODE
+// =============================================================================
+
+void DiffDrive::setGeometry(float wheelRadius, float trackWidth) {
+  _wheelRadius = wheelRadius;
+  _trackWidth = trackWidth;
+}
+
+void DiffDrive::setMaxWheelSpeed(float radPerSec) {
+  _maxWheelSpeed = (radPerSec < 0.0) ? -radPerSec : radPerSec;
+}
+
+void DiffDrive::setAccelLimits(float linAccel, float angAccel, float linJerk, float angJerk) {
+  _linear.setLimits(linAccel, linJerk);
+  _angular.setLimits(angAccel, angJerk);
+  _limited = true;
+}
+
+/**
+ * @brief Inverse kinematics:
+ * wL = (v - w * track / 2) / r
+ * wR = (v + w * track / 2) / r
+ */
+void DiffDrive::computeVelocity(float v, float w) {
+  if (_wheelRadius <= 0.0)
+  {
+    _leftVel = 0.0;
+    _rightVel = 0.0;
+    return;
+  }
+
+  float half = w * _trackWidth * 0.5;
+  float left = (v - half) / _wheelRadius;
+  float right = (v + half) / _wheelRadius;
+
+  // Ratio-preserving saturation, same rule as the joystick mixer
+  if (_maxWheelSpeed > 0.0)
+  {
+    float absLeft = (left < 0.0) ? -left : left;
+    float absRight = (right < 0.0) ? -right : right;
+    float mag = (absLeft > absRight) ? absLeft : absRight;
+    if (mag > _maxWheelSpeed)
+    {
+      float k = _maxWheelSpeed / mag;
+      left *= k;
+      right *= k;
+    }
+  }
+
+  _leftVel = left;
+  _rightVel = right;
+}
+
+void DiffDrive::computeVelocity(float v, float w, float dt) {
+  if (_limited)
+  {
+    v = _linear.update(v, dt);
+    w = _angular.update(w, dt);
+  }
+  else
+  {
+    _linear.reset(v);
+    _angular.reset(w);
+  }
+  computeVelocity(v, w);
+}
+
+void DiffDrive::stop() {
+  _linear.reset(0.0);
+  _angular.reset(0.0);
+  _leftVel = 0.0;
+  _rightVel = 0.0;
+}
+
+float DiffDrive::getLeftVelocity() {
+  return _leftVel;
+}
+
+float DiffDrive::getRightVelocity() {
+  return _rightVel;
+}
+
+float DiffDrive::getLinear() {
+  return _linear.getValue();
+}
+
+float DiffDrive::getAngular() {
+  return _angular.getValue();
+}
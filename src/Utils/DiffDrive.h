@@ -3,8 +3,10 @@
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief Differential Drive Kinematics Solver (Arcade Drive).
  * Converts Joystick (X, Y) inputs into Left/Right Motor speeds.
- * @version 1.0.0
- * @date 2025-12-30
+ * Integer-only mixer with turn-ratio-preserving normalization.
+ * Velocity mode: (v, w) -> wheel speeds with acceleration/jerk limiting.
+ * @version 1.2.1
+ * @date 2026-10-18
  *
  * @copyright Copyright (c) 2025 Furkan
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,37 +19,89 @@
 #define DIFF_DRIVE_H
 
 #include <Arduino.h>
+#include "MotionProfile.h"
+
+#define DIFF_DRIVE_INPUT_MAX 100 // Joystick range is -100..100 (percent)
 
 /**
  * @brief Handles mixing logic for tank-style or 2WD robots.
  * Implements "Arcade Drive" mixing algorithm.
+ *
+ * compute() is integer-only: the response curve (deadband + expo) is a
+ * 101-entry lookup table built once when the curve changes, and
+ * normalization uses a reciprocal table instead of a division.
+ * When Y + X exceeds full scale, both wheels are divided by the larger
+ * magnitude, so the left/right ratio (the arc radius) is preserved.
+ *
+ * Full stick is full speed: compute(0, 100) gives maxPWM on both wheels.
+ * Before 1.2 the mixer mapped -200..200 onto -maxPWM..maxPWM, so straight
+ * driving peaked at maxPWM / 2. Sketches tuned for the old mixer reach
+ * the same speeds with half the throttle input (e.g. y = 40 instead of 80).
+ *
+ * Velocity mode (setGeometry + computeVelocity) works in physical units:
+ * linear speed v (m/s) and turn rate w (rad/s) become wheel angular speeds
+ * (rad/s), ready as setpoints for per-wheel FastPID loops. With
+ * setAccelLimits() both commands pass through SlewLimiters first, so a
+ * joystick jump becomes a ramp (trapezoidal) or an S-curve (jerk > 0).
+ *
+ * Usage Example (inside a 20 ms TaskManager task):
+ * drive.setGeometry(0.033, 0.16);
+ * drive.setAccelLimits(0.5, 3.0);
+ * drive.computeVelocity(0.3, 0.0, 0.02);
+ * leftSetpoint = drive.getLeftVelocity();
  */
 class DiffDrive {
   private:
     int _maxPWM;      // Maximum motor speed limit (e.g., 255 or 1023)
     int _deadband;    // Joystick center tolerance to ignore noise
+    int _expo;        // Expo amount in percent (0 = linear)
+    unsigned long _pwmScale; // maxPWM / 100 in Q8 (percent -> PWM)
+    uint8_t _curve[DIFF_DRIVE_INPUT_MAX + 1]; // Response curve LUT (0..100 -> 0..100)
     int _leftSpeed;   // Calculated Result for Left Motor
     int _rightSpeed;  // Calculated Result for Right Motor
 
+    float _wheelRadius;    // m
+    float _trackWidth;     // m (wheel to wheel)
+    float _maxWheelSpeed;  // rad/s, 0 = unlimited
+    bool _limited;         // Acceleration limits enabled
+    SlewLimiter _linear;   // v limiter (m/s)
+    SlewLimiter _angular;  // w limiter (rad/s)
+    float _leftVel;        // Calculated wheel speed (rad/s)
+    float _rightVel;
+
+    void buildCurve();
+    int shape(int v) const;
+    int toPWM(unsigned long pctQ8) const;
+
   public:
     /**
      * @brief Construct a new Diff Drive object.
      * @param maxPWM Maximum PWM value your motor driver accepts (Default: 255).
      * For Robotis OpenCM, this is usually 1023. For Arduino PWM, 255.
+     * Up to 32767.
      */
     DiffDrive(int maxPWM = 255);
     
     /**
      * @brief Sets the deadband threshold.
-     * Inputs smaller than this value will be treated as 0.
+     * Inputs smaller than this value will be treated as 0. Inputs above it
+     * are rescaled so the output rises smoothly from 0 (no jump at the edge).
      * @param limit Deadband value (e.g., 5 or 10).
      */
     void setDeadband(int limit);
 
+    /**
+     * @brief Sets the expo response curve: out = (1 - e) * in + e * in^3.
+     * Softer control around center, full speed still reachable.
+     * @param percent Expo amount 0 (linear) .. 100 (pure cubic).
+     */
+    void setExpo(int percent);
+
     /**
      * @brief Performs the mixing calculation.
      * @param x Turn Input (-100 to 100). Positive = Right.
      * @param y Throttle Input (-100 to 100). Positive = Forward.
+     * 100 = maxPWM (not maxPWM / 2 as before 1.2).
      */
     void compute(int x, int y);
     
@@ -62,6 +116,54 @@ class DiffDrive {
      * @return int PWM value (-maxPWM to +maxPWM).
      */
     int getRight();
+
+    // --- Velocity (Kinematics) Mode ---
+
+    /**
+     * @brief Sets the robot geometry for velocity mode.
+     * @param wheelRadius Wheel radius in meters.
+     * @param trackWidth Distance between wheel contact points in meters.
+     */
+    void setGeometry(float wheelRadius, float trackWidth);
+
+    /**
+     * @brief Caps wheel speed. Overshooting commands are scaled down on both
+     * wheels together, so the arc radius is kept (as in compute()).
+     * @param radPerSec Max wheel angular speed (0 = unlimited).
+     */
+    void setMaxWheelSpeed(float radPerSec);
+
+    /**
+     * @brief Enables acceleration limiting of v and w.
+     * @param linAccel Max linear acceleration (m/s^2), 0 = unlimited.
+     * @param angAccel Max angular acceleration (rad/s^2), 0 = unlimited.
+     * @param linJerk Max linear jerk (m/s^3), 0 = trapezoidal.
+     * @param angJerk Max angular jerk (rad/s^3), 0 = trapezoidal.
+     */
+    void setAccelLimits(float linAccel, float angAccel, float linJerk = 0.0, float angJerk = 0.0);
+
+    /**
+     * @brief Converts (v, w) to wheel speeds, without limiting.
+     * @param v Linear speed (m/s). Positive = Forward.
+     * @param w Angular speed (rad/s). Positive = Left (counter-clockwise).
+     */
+    void computeVelocity(float v, float w);
+
+    /**
+     * @brief Same as above, but v and w are first slewed for one tick of dt
+     * seconds through the acceleration limits. Call once per control tick.
+     */
+    void computeVelocity(float v, float w, float dt);
+
+    /**
+     * @brief Immediately zeroes the limited commands (e.g. emergency stop).
+     */
+    void stop();
+
+    float getLeftVelocity();   // rad/s
+    float getRightVelocity();  // rad/s
+    float getLinear();         // Current (limited) v, m/s
+    float getAngular();        // Current (limited) w, rad/s
 };
 
-#endif
\ No newline at end of file
+#endif
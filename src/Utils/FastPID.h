@@ -3,8 +3,10 @@
  * @author iamfurkann (esadfurkanduman@gmail.com)
  * @brief High-Performance PID Controller Implementation.
  * Features: Integral Windup Guard, Derivative on Measurement, Output Limiting.
- * @version 1.0.0
- * @date 2025-12-30
+ * Templated on its numeric type: float (FastPID) or fixed-point (FixedPID).
+ * Millisecond or microsecond time base with measured-dt scaling.
+ * @version 1.2.3
+ * @date 2026-10-18
  *
  * @copyright Copyright (c) 2025 Furkan
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,48 +19,168 @@
 #define FAST_PID_H
 
 #include <Arduino.h>
+#include "FixedPoint.h"
+
+// =============================================================================
+// TIME BASES
+// =============================================================================
+#define PID_TIMEBASE_MILLIS 0  // Sample time and timestamps in ms (default)
+#define PID_TIMEBASE_MICROS 1  // Sample time and timestamps in us (> 1 kHz loops)
+
+#define PID_MAX_DT_RATIO 4 // A late sample integrates at most 4 sample times
+
+/**
+ * @brief Exact tick ratio num / den in the controller's numeric type.
+ * Fixed-point types provide T::ratio(); float is specialized below.
+ */
+template <class T>
+struct PIDRatio {
+  static T get(unsigned long num, unsigned long den) {
+    return T::ratio(num, den);
+  }
+};
+
+template <>
+struct PIDRatio<float> {
+  static float get(unsigned long num, unsigned long den) {
+    return (float)num / (float)den;
+  }
+};
+
+/**
+ * @brief I-term scale dt / Ts, capped at PID_MAX_DT_RATIO. One very late
+ * call (blocking EEPROM write, debugger halt) would otherwise add
+ * ki * error * dt/Ts to the integral in one step and kick the output.
+ */
+template <class T>
+inline T pidDtRatio(unsigned long timeChange, unsigned long sampleTime) {
+  if (timeChange > sampleTime * PID_MAX_DT_RATIO)
+    return T(PID_MAX_DT_RATIO);
+  return PIDRatio<T>::get(timeChange, sampleTime);
+}
 
 /**
  * @brief A standard PID controller optimized for microcontrollers.
- * Uses floating point math to calculate control signals based on error.
+ * The math runs in type T, so FPU-less chips (AVR, Cortex-M0) can use a
+ * saturating fixed-point type instead of soft-float.
+ *
+ * Gains are tuned for the nominal sample time. When a call arrives late
+ * (or early, with an external clock) the I term is scaled by dt/Ts and the
+ * D term by Ts/dt, so the effective gains do not drift with loop jitter.
+ * dt/Ts is capped at PID_MAX_DT_RATIO, so a stall adds at most that many
+ * samples' worth of integral.
+ *
+ * Usage Example:
+ * FastPID  pid(5.0, 0.1, 2.0, 50);  // float
+ * FixedPID fix(5.0, 0.1, 2.0, 50);  // Q16.16, integer-only compute()
+ * Q16_16 out = fix.compute(Q16_16(20), Q16_16(dist));
+ *
+ * // 4 kHz current loop, one micros() read shared by several controllers
+ * pid.setSampleTime(250, PID_TIMEBASE_MICROS);
+ * pid.setDerivativeFilter(500); // D low-pass, tau = 500us
+ * unsigned long now = micros();
+ * float u = pid.compute(target, current, now);
+ *
+ * @tparam T Numeric type (float, or FixedPoint<F>).
  */
-class FastPID {
+template <class T>
+class BasicFastPID {
   private:
-    float _kp;             // Proportional Gain
-    float _ki;             // Integral Gain
-    float _kd;             // Derivative Gain
-    
-    float _lastInput;      // Last sensor reading (for Derivative calc)
-    float _integral;       // Accumulated error
-    
-    float _outputMin;      // Lower limit of output (e.g. -255)
-    float _outputMax;      // Upper limit of output (e.g. 255)
-    
+    T _kp;             // Proportional Gain
+    T _ki;             // Integral Gain
+    T _kd;             // Derivative Gain
+
+    T _lastInput;      // Last sensor reading (for Derivative calc)
+    T _integral;       // Accumulated error
+
+    T _outputMin;      // Lower limit of output (e.g. -255)
+    T _outputMax;      // Upper limit of output (e.g. 255)
+
+    T _dFiltered;      // Low-passed derivative (per nominal sample)
+
     unsigned long _lastTime;
-    unsigned long _sampleTime; // Calculation interval in ms
-    float _lastOutput;     // Stores result if called before sample time
+    unsigned long _sampleTime; // Calculation interval (ms or us)
+    unsigned long _dFilterTau; // Derivative filter time constant (0 = off)
+    int _timeBase;             // PID_TIMEBASE_MILLIS or PID_TIMEBASE_MICROS
+    bool _firstRun;            // Next compute() runs immediately with dt = Ts
+    T _lastOutput;     // Stores result if called before sample time
 
   public:
     /**
-     * @brief Construct a new FastPID object.
+     * @brief Construct a new PID object.
      * @param kp Proportional Term (Reaction speed).
      * @param ki Integral Term (Steady-state error correction).
      * @param kd Derivative Term (Damping/Prediction).
      * @param sampleTime How often to calculate PID in ms (default: 20ms).
      */
-    FastPID(float kp, float ki, float kd, int sampleTime = 20);
+    BasicFastPID(T kp, T ki, T kd, int sampleTime = 20) {
+      _kp = kp;
+      _ki = ki;
+      _kd = kd;
+      _sampleTime = sampleTime;
+      _timeBase = PID_TIMEBASE_MILLIS;
+      _dFilterTau = 0;
+
+      // Default PWM limits for Arduino/OpenCM
+      _outputMin = T(-255);
+      _outputMax = T(255);
+
+      _lastTime = 0;
+      _firstRun = true; // Force immediate first calculation
+      _lastOutput = T(0);
+      reset();
+    }
+
+    /**
+     * @brief Changes the calculation interval and its time base.
+     * @param sampleTime Interval in ms, or in us for PID_TIMEBASE_MICROS.
+     * 0 computes on every call without dt scaling, including repeated
+     * calls with the same timestamp (e.g. an event-driven loop).
+     * @param timeBase PID_TIMEBASE_MILLIS (default) or PID_TIMEBASE_MICROS.
+     */
+    void setSampleTime(unsigned long sampleTime, int timeBase = PID_TIMEBASE_MILLIS) {
+      if (timeBase != _timeBase)
+        _firstRun = true; // Old timestamp is in the wrong unit
+      _sampleTime = sampleTime;
+      _timeBase = timeBase;
+    }
+
+    /**
+     * @brief Enables a first-order low-pass on the derivative term.
+     * alpha = dt / (tau + dt) is recomputed from the measured dt each sample.
+     * @param tau Time constant in time-base ticks (ms or us). 0 disables it.
+     */
+    void setDerivativeFilter(unsigned long tau) {
+      _dFilterTau = tau;
+    }
 
     /**
      * @brief Sets the output limits to prevent saturation.
      * @param min Minimum output (e.g., -255 for reverse motor).
      * @param max Maximum output (e.g., 255 for forward motor).
      */
-    void setOutputLimits(float min, float max);
+    void setOutputLimits(T min, T max) {
+      if (min >= max) return; // Error check
+      _outputMin = min;
+      _outputMax = max;
+
+      // Clamp existing integral to new limits
+      if (_integral > _outputMax)
+        _integral = _outputMax;
+      else if (_integral < _outputMin)
+        _integral = _outputMin;
+    }
 
     /**
      * @brief Updates PID tunings dynamically.
      */
-    void setTunings(float kp, float ki, float kd);
+    void setTunings(T kp, T ki, T kd) {
+      if (kp < T(0) || ki < T(0) || kd < T(0))
+        return;
+      _kp = kp;
+      _ki = ki;
+      _kd = kd;
+    }
 
     /**
      * @brief Calculates the PID output.
@@ -66,15 +188,99 @@ class FastPID {
      * if the sample time has passed.
      * * @param setpoint The target value (Where we want to be).
      * @param input The actual sensor value (Where we are now).
-     * @return float The control output (Power to apply to motors).
+     * @return T The control output (Power to apply to motors).
      */
-    float compute(float setpoint, float input);
+    T compute(T setpoint, T input) {
+      unsigned long now = (_timeBase == PID_TIMEBASE_MICROS) ? micros() : millis();
+      return compute(setpoint, input, now);
+    }
+
+    /**
+     * @brief Calculates the PID output from an externally supplied timestamp.
+     * Lets a scheduler read the clock once and pass it to many controllers.
+     * @param now Current time in the controller's time base (ms or us).
+     */
+    T compute(T setpoint, T input, unsigned long now) {
+      unsigned long timeChange = (now - _lastTime);
+
+      if (_firstRun)
+        timeChange = _sampleTime;
+      else if (timeChange == 0 && _sampleTime > 0)
+        return _lastOutput; // Same timestamp twice: nothing new to integrate
+
+      // Only calculate if sample time has passed
+      if (timeChange >= _sampleTime) {
+        // 0. Measured dt relative to the nominal sample time
+        T dtRatio = T(1);   // dt / Ts  (scales I)
+        T rateScale = T(1); // Ts / dt  (scales D)
+        if (_sampleTime > 0 && timeChange != _sampleTime)
+        {
+          dtRatio = pidDtRatio<T>(timeChange, _sampleTime);
+          rateScale = PIDRatio<T>::get(_sampleTime, timeChange);
+        }
+
+        // 1. Calculate Error
+        T error = setpoint - input;
+
+        // 2. Calculate Integral (Accumulated Error)
+        // Integral = Integral + (Ki * Error * dt/Ts)
+        _integral += (_ki * error * dtRatio);
+
+        // [Integral Windup Guard]
+        // Prevent integral from growing infinitely if actuator is saturated
+        if (_integral > _outputMax)
+          _integral = _outputMax;
+        else if (_integral < _outputMin)
+          _integral = _outputMin;
+
+        // 3. Calculate Derivative (Rate of Change)
+        // Technique: "Derivative on Measurement" (dInput instead of dError)
+        // This prevents "Derivative Kick" when setpoint changes abruptly.
+        T dInput = (input - _lastInput) * rateScale;
+
+        // [Derivative Filter] First-order low-pass against sensor noise
+        // keep = tau / (tau + dt) = 1 - alpha; 0 passes dInput through exactly
+        T keep = T(0);
+        if (_dFilterTau > 0)
+          keep = PIDRatio<T>::get(_dFilterTau, _dFilterTau + timeChange);
+        _dFiltered = dInput + keep * (_dFiltered - dInput);
+
+        // 4. Compute Final Output
+        // Output = P + I - D
+        T output = (_kp * error) + _integral - (_kd * _dFiltered);
+
+        // 5. Limit Output
+        if (output > _outputMax)
+          output = _outputMax;
+        else if (output < _outputMin)
+          output = _outputMin;
+
+        // 6. Save State variables for next loop
+        _lastInput = input;
+        _lastTime = now;
+        _firstRun = false;
+        _lastOutput = output;
+      }
+
+      return _lastOutput;
+    }
 
     /**
      * @brief Resets the integral term and history.
      * Call this when starting a new motion to avoid old accumulated errors.
      */
-    void reset();
+    void reset() {
+      _integral = T(0);
+      _lastInput = T(0);
+      _dFiltered = T(0);
+      _lastOutput = T(0);
+    }
 };
 
-#endif
\ No newline at end of file
+// Float controller (original API, uses the FPU where available)
+typedef BasicFastPID<float> FastPID;
+
+// Q16.16 controller: integer-only compute(), saturating on overflow
+typedef BasicFastPID<Q16_16> FixedPID;
+
+#endif
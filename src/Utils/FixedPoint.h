@@ -0,0 +1,172 @@
+/**
+ * @file FixedPoint.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Saturating Fixed-Point Number Type (Qm.n) for FPU-less MCUs.
+ * Drop-in numeric type for templated math such as BasicFastPID<T>.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <Arduino.h>
+
+#define FIXED_RAW_MAX ((int32_t)0x7FFFFFFF)
+#define FIXED_RAW_MIN ((int32_t)(-0x7FFFFFFF - 1))
+
+// No 32x32->64 multiply instruction: build products from 16-bit halves
+#if defined(__AVR__) || defined(__ARM_ARCH_6M__)
+  #define FIXED_NARROW_MUL
+#endif
+
+/**
+ * @brief Exact 32x32 -> 64-bit signed product from four 16x16 -> 32
+ * products. AVR and Cortex-M0 otherwise call a full 64x64 multiply.
+ */
+inline int64_t fixedMulWide(int32_t a, int32_t b) {
+  int16_t ah = (int16_t)(a >> 16);
+  int16_t bh = (int16_t)(b >> 16);
+  uint16_t al = (uint16_t)a;
+  uint16_t bl = (uint16_t)b;
+
+  int64_t r = (int64_t)((int32_t)ah * bh) << 32;
+  r += (int64_t)((int32_t)ah * (int32_t)bl) << 16;
+  r += (int64_t)((int32_t)bh * (int32_t)al) << 16;
+  r += (uint32_t)al * bl;
+  return r;
+}
+
+/**
+ * @brief Signed 32-bit fixed-point number with F fractional bits.
+ * All arithmetic saturates at the type limits instead of wrapping,
+ * so a runaway integral or a large gain can never flip the output sign.
+ *
+ * Usage Example:
+ * Q16_16 a = 1.5;          // From float/double/int/long
+ * Q16_16 b = a * 2 - 0.25; // 2.75
+ * float  f = b.toFloat();
+ *
+ * @tparam F Number of fractional bits (1..30). Q16.16 covers +/-32767
+ * with a resolution of ~0.000015.
+ */
+template <int F>
+class FixedPoint {
+  private:
+    int32_t _raw;
+
+    static int32_t clamp64(int64_t v) {
+      if (v > (int64_t)FIXED_RAW_MAX)
+        return FIXED_RAW_MAX;
+      if (v < (int64_t)FIXED_RAW_MIN)
+        return FIXED_RAW_MIN;
+      return (int32_t)v;
+    }
+
+    static int32_t fromFloat(float v) {
+      float scaled = v * (float)((int32_t)1 << F);
+      // Compare in float before converting: out-of-range casts are undefined
+      if (scaled >= 2147483520.0f)
+        return FIXED_RAW_MAX;
+      if (scaled <= -2147483648.0f)
+        return FIXED_RAW_MIN;
+      return (int32_t)(scaled >= 0 ? scaled + 0.5f : scaled - 0.5f);
+    }
+
+    static int32_t addSat(int32_t a, int32_t b) {
+      int32_t r = (int32_t)((uint32_t)a + (uint32_t)b);
+      // Overflow only if both operands share a sign the result does not
+      if (((a ^ r) & (b ^ r)) < 0)
+        return (a < 0) ? FIXED_RAW_MIN : FIXED_RAW_MAX;
+      return r;
+    }
+
+  public:
+    FixedPoint() : _raw(0) {}
+    FixedPoint(int v) : _raw(clamp64((int64_t)v << F)) {}
+    FixedPoint(long v) : _raw(clamp64((int64_t)v << F)) {}
+    FixedPoint(float v) : _raw(fromFloat(v)) {}
+    FixedPoint(double v) : _raw(fromFloat((float)v)) {}
+
+    /**
+     * @brief Builds a value directly from its raw integer representation.
+     */
+    static FixedPoint fromRaw(int32_t raw) {
+      FixedPoint r;
+      r._raw = raw;
+      return r;
+    }
+
+    /**
+     * @brief Exact ratio num / den of two integers (e.g. elapsed ticks).
+     * For den <= 2^(32-F) (65536 ticks in Q16.16) this is one 32-bit
+     * divide: floor(num * 2^F / den) = q * 2^F + floor(r * 2^F / den)
+     * with q, r = num / den, num % den. Larger denominators take the
+     * 64-bit division. Both give the same result.
+     */
+    static FixedPoint ratio(unsigned long num, unsigned long den) {
+      if (den == 0)
+        return fromRaw(FIXED_RAW_MAX);
+      if (den <= ((uint32_t)1 << (32 - F)) && num <= 0xFFFFFFFFUL)
+      {
+        uint32_t q = (uint32_t)num / (uint32_t)den;
+        uint32_t r = (uint32_t)num - q * (uint32_t)den;
+        if (q >= ((uint32_t)1 << (31 - F)))
+          return fromRaw(FIXED_RAW_MAX);
+        return fromRaw((int32_t)((q << F) + (r << F) / (uint32_t)den));
+      }
+      return fromRaw(clamp64((int64_t)(((uint64_t)num << F) / den)));
+    }
+
+    int32_t raw() const { return _raw; }
+    float toFloat() const { return (float)_raw / (float)((int32_t)1 << F); }
+    long toInt() const { return (long)(_raw >> F); } // Rounds toward -inf
+
+    // =========================================================================
+    // SATURATING ARITHMETIC
+    // =========================================================================
+
+    FixedPoint operator+(const FixedPoint& o) const { return fromRaw(addSat(_raw, o._raw)); }
+    FixedPoint operator-(const FixedPoint& o) const { return fromRaw(clamp64((int64_t)_raw - o._raw)); }
+    FixedPoint operator-() const { return fromRaw(_raw == FIXED_RAW_MIN ? FIXED_RAW_MAX : -_raw); }
+
+    FixedPoint operator*(const FixedPoint& o) const {
+      // Round to nearest before dropping the extra fractional bits
+#if defined(FIXED_NARROW_MUL)
+      int64_t p = fixedMulWide(_raw, o._raw) + ((int64_t)1 << (F - 1));
+#else
+      int64_t p = (int64_t)_raw * o._raw + ((int64_t)1 << (F - 1));
+#endif
+      return fromRaw(clamp64(p >> F));
+    }
+
+    FixedPoint operator/(const FixedPoint& o) const {
+      if (o._raw == 0)
+        return fromRaw(_raw < 0 ? FIXED_RAW_MIN : FIXED_RAW_MAX);
+      return fromRaw(clamp64(((int64_t)_raw * ((int64_t)1 << F)) / o._raw));
+    }
+
+    FixedPoint& operator+=(const FixedPoint& o) { *this = *this + o; return *this; }
+    FixedPoint& operator-=(const FixedPoint& o) { *this = *this - o; return *this; }
+    FixedPoint& operator*=(const FixedPoint& o) { *this = *this * o; return *this; }
+    FixedPoint& operator/=(const FixedPoint& o) { *this = *this / o; return *this; }
+
+    bool operator<(const FixedPoint& o) const { return _raw < o._raw; }
+    bool operator>(const FixedPoint& o) const { return _raw > o._raw; }
+    bool operator<=(const FixedPoint& o) const { return _raw <= o._raw; }
+    bool operator>=(const FixedPoint& o) const { return _raw >= o._raw; }
+    bool operator==(const FixedPoint& o) const { return _raw == o._raw; }
+    bool operator!=(const FixedPoint& o) const { return _raw != o._raw; }
+};
+
+// Common formats
+typedef FixedPoint<16> Q16_16; // +/-32767, resolution 1.5e-5 (default for PID)
+typedef FixedPoint<24> Q8_24;  // +/-127,   resolution 6.0e-8 (small gains)
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * @file FixedTrig.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of the fixed-point sine / cosine.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "FixedTrig.h"
+
+// round(32768 * sin(i * 90deg / 256)), i = 0..256 (one extra entry for interpolation)
+static const uint16_t SINE_QUARTER[257] PROGMEM = {
+  0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809,
+  2009, 2210, 2411, 2611, 2811, 3012, 3212, 3412, 3612, 3812,
+  4011, 4211, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800,
+  5998, 6195, 6393, 6590, 6787, 6983, 7180, 7376, 7571, 7767,
+  7962, 8157, 8351, 8546, 8740, 8933, 9127, 9319, 9512, 9704,
+  9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605,
+  11793, 11980, 12167, 12354, 12540, 12725, 12910, 13095, 13279, 13463,
+  13646, 13828, 14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269,
+  15447, 15624, 15800, 15976, 16151, 16326, 16500, 16673, 16846, 17018,
+  17190, 17361, 17531, 17700, 17869, 18037, 18205, 18372, 18538, 18703,
+  18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001, 20160, 20318,
+  20475, 20632, 20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856,
+  22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028, 23170, 23312,
+  23453, 23593, 23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680,
+  24812, 24943, 25073, 25202, 25330, 25457, 25583, 25708, 25833, 25956,
+  26078, 26199, 26320, 26439, 26557, 26674, 26791, 26906, 27020, 27133,
+  27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002, 28106, 28209,
+  28311, 28411, 28511, 28610, 28707, 28803, 28899, 28993, 29086, 29178,
+  29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038,
+  30118, 30196, 30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784,
+  30853, 30920, 30986, 31050, 31114, 31177, 31238, 31298, 31357, 31415,
+  31471, 31527, 31581, 31634, 31686, 31737, 31786, 31834, 31881, 31927,
+  31972, 32015, 32058, 32099, 32138, 32177, 32214, 32251, 32286, 32319,
+  32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+  32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738,
+  32746, 32753, 32758, 32762, 32766, 32767, 32768
+};
+
+int32_t fixedSin(uint32_t angle) {
+  // 1. Split: 2 bits quadrant | 8 bits table index | 16 bits fraction
+  uint8_t quadrant = (uint8_t)(angle >> 30);
+  uint32_t inQuad = angle & (BINANGLE_QUARTER_TURN - 1);
+  if (quadrant & 1)
+    inQuad = BINANGLE_QUARTER_TURN - inQuad; // Mirror: 90..180 reads 90..0
+
+  uint16_t index = (uint16_t)(inQuad >> 22);
+  uint32_t frac = (inQuad >> 6) & 0xFFFFUL;
+
+  // 2. Interpolate (index 256 only when exactly 90 deg, frac is 0 then)
+  int32_t s0 = (int32_t)pgm_read_word(&SINE_QUARTER[index]);
+  int32_t value = s0;
+  if (frac != 0)
+  {
+    int32_t s1 = (int32_t)pgm_read_word(&SINE_QUARTER[index + 1]);
+    value += (int32_t)(((s1 - s0) * (int32_t)frac + 0x8000L) >> 16);
+  }
+
+  // 3. Lower half-turn is positive
+  return (quadrant & 2) ? -value : value;
+}
+
+int32_t fixedCos(uint32_t angle) {
+  return fixedSin(angle + BINANGLE_QUARTER_TURN);
+}
+
+uint32_t radiansToAngle(float radians) {
+  // Wrap to -PI..PI first so the scaled value fits in int32_t
+  float turns = radians / 6.2831853;
+  turns -= floor(turns + 0.5);
+  return (uint32_t)(int32_t)(turns * 4294967296.0);
+}
+
+float angleToRadians(uint32_t angle) {
+  return (float)(int32_t)angle * (6.2831853 / 4294967296.0);
+}
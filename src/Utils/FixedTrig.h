@@ -0,0 +1,53 @@
+/**
+ * @file FixedTrig.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Fixed-Point Sine / Cosine on Binary Angles.
+ * Quarter-wave lookup table with linear interpolation, no float math.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef FIXED_TRIG_H
+#define FIXED_TRIG_H
+
+#include <Arduino.h>
+
+// Binary angle: the full uint32_t range is one turn (2^32 = 2*PI), so
+// heading arithmetic wraps for free with unsigned overflow.
+#define BINANGLE_HALF_TURN 0x80000000UL
+#define BINANGLE_QUARTER_TURN 0x40000000UL
+
+#define FIXED_TRIG_ONE 32768L // Q15 result scale (sin(90 deg) == 32768)
+
+/**
+ * @brief Sine of a binary angle.
+ * 257-entry quarter-wave PROGMEM table, linear interpolation.
+ * Max error about one Q15 step (3e-5).
+ * @param angle Binary angle (0x40000000 = 90 deg).
+ * @return int32_t Q15 value in -32768..32768.
+ */
+int32_t fixedSin(uint32_t angle);
+
+/**
+ * @brief Cosine of a binary angle (sine shifted by a quarter turn).
+ * @return int32_t Q15 value in -32768..32768.
+ */
+int32_t fixedCos(uint32_t angle);
+
+/**
+ * @brief Radians -> binary angle (any real angle, wrapped to one turn).
+ */
+uint32_t radiansToAngle(float radians);
+
+/**
+ * @brief Binary angle -> radians in -PI..PI.
+ */
+float angleToRadians(uint32_t angle);
+
+#endif
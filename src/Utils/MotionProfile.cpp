@@ -0,0 +1,269 @@
+/**
+ * @file MotionProfile.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of SlewLimiter and MotionProfile.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "MotionProfile.h"
+
+// =============================================================================
+// SLEW LIMITER
+// =============================================================================
+
+SlewLimiter::SlewLimiter(float maxRate, float maxJerk) {
+  _maxRate = maxRate;
+  _maxJerk = maxJerk;
+  _value = 0.0;
+  _rate = 0.0;
+}
+
+void SlewLimiter::setLimits(float maxRate, float maxJerk) {
+  _maxRate = (maxRate < 0.0) ? -maxRate : maxRate;
+  _maxJerk = (maxJerk < 0.0) ? -maxJerk : maxJerk;
+}
+
+void SlewLimiter::reset(float value) {
+  _value = value;
+  _rate = 0.0;
+}
+
+/**
+ * @brief One incremental step. Nothing about the future is stored.
+ */
+float SlewLimiter::update(float target, float dt) {
+  float error = target - _value;
+
+  // 1. Unlimited: follow directly
+  if (_maxRate <= 0.0 || dt <= 0.0)
+  {
+    _value = target;
+    _rate = 0.0;
+    return _value;
+  }
+
+  // 2. Trapezoidal: clamp the step to maxRate * dt
+  if (_maxJerk <= 0.0)
+  {
+    float step = _maxRate * dt;
+    if (error > step)
+      error = step;
+    else if (error < -step)
+      error = -step;
+    _value += error;
+    _rate = error / dt;
+    return _value;
+  }
+
+  // 3. S-curve in discrete time: the rate moves by at most dRate per tick.
+  // Braking from (n + f) * dRate down to 0, one dRate per tick, covers
+  // (n(n+1)/2 + (n+1) f) * dRate * dt, so the fastest rate that still
+  // lands exactly on the target comes from solving that for the error.
+  float dRate = _maxJerk * dt;
+  float mag = (error < 0.0) ? -error : error;
+  float units = mag / (dRate * dt);
+  float n = floor((sqrt(8.0 * units + 1.0) - 1.0) / 2.0);
+  if ((n + 1.0) * (n + 2.0) / 2.0 <= units) // Float rounding of the root
+    n += 1.0;
+  else if (n > 0.0 && n * (n + 1.0) / 2.0 > units)
+    n -= 1.0;
+  float wanted = (n + (units - n * (n + 1.0) / 2.0) / (n + 1.0)) * dRate;
+  bool lands = (n < 1.0); // wanted * dt == mag: this tick reaches the target
+  if (wanted > _maxRate)
+  {
+    wanted = _maxRate;
+    lands = false;
+  }
+  if (error < 0.0)
+    wanted = -wanted;
+
+  // 4. Jerk limit. If the target moved closer than the braking distance,
+  // the rate keeps this limit and the value overshoots, then returns.
+  if (wanted > _rate + dRate)
+    _rate += dRate;
+  else if (wanted < _rate - dRate)
+    _rate -= dRate;
+  else
+  {
+    _rate = wanted;
+    if (lands)
+    {
+      _value = target; // Exact, the rate drops to 0 on the next tick
+      return _value;
+    }
+  }
+
+  _value += _rate * dt;
+  return _value;
+}
+
+float SlewLimiter::getValue() const {
+  return _value;
+}
+
+float SlewLimiter::getRate() const {
+  return _rate;
+}
+
+// =============================================================================
+// MOTION PROFILE (7-segment S-curve)
+// =============================================================================
+
+MotionProfile::MotionProfile() {
+  int i;
+
+  i = 0;
+  while (i < 8)
+  {
+    _t[i] = 0.0;
+    _p[i] = 0.0;
+    _v[i] = 0.0;
+    _a[i] = 0.0;
+    if (i < 7)
+      _j[i] = 0.0;
+    i++;
+  }
+  _sign = 1.0;
+}
+
+/**
+ * @brief Distance covered while accelerating from rest to vPeak.
+ */
+float MotionProfile::accelDistance(float vPeak, float maxAcc, float maxJerk) {
+  float tj = maxAcc / maxJerk;
+  float ta;
+
+  if (vPeak < maxAcc * tj)
+  {
+    // maxAcc is never reached: two jerk segments only
+    tj = sqrt(vPeak / maxJerk);
+    ta = 0.0;
+  }
+  else
+    ta = vPeak / maxAcc - tj;
+
+  // Symmetric ramp: average velocity is vPeak / 2
+  return vPeak * (2.0 * tj + ta) / 2.0;
+}
+
+bool MotionProfile::plan(float distance, float maxVel, float maxAcc, float maxJerk) {
+  if (maxVel <= 0.0 || maxAcc <= 0.0 || maxJerk <= 0.0)
+    return false;
+
+  _sign = (distance < 0.0) ? -1.0 : 1.0;
+  float d = distance * _sign;
+
+  // 1. Peak velocity: maxVel if there is room to cruise, else the largest
+  // vPeak whose accel + decel ramps fit in d (monotonic -> bisection).
+  float vPeak = maxVel;
+  if (2.0 * accelDistance(vPeak, maxAcc, maxJerk) > d)
+  {
+    float lo = 0.0;
+    float hi = maxVel;
+    int i;
+
+    i = 0;
+    while (i < 32)
+    {
+      float mid = 0.5 * (lo + hi);
+      if (2.0 * accelDistance(mid, maxAcc, maxJerk) > d)
+        hi = mid;
+      else
+        lo = mid;
+      i++;
+    }
+    vPeak = lo;
+  }
+
+  // 2. Segment durations
+  float tj = maxAcc / maxJerk;
+  float ta;
+  if (vPeak < maxAcc * tj)
+  {
+    tj = sqrt(vPeak / maxJerk);
+    ta = 0.0;
+  }
+  else
+    ta = vPeak / maxAcc - tj;
+
+  float tv = (vPeak > 0.0) ? (d - 2.0 * accelDistance(vPeak, maxAcc, maxJerk)) / vPeak : 0.0;
+  if (tv < 0.0)
+    tv = 0.0;
+
+  float dur[7] = {tj, ta, tj, tv, tj, ta, tj};
+  float jerk[7] = {maxJerk, 0.0, -maxJerk, 0.0, -maxJerk, 0.0, maxJerk};
+
+  // 3. Integrate segment start states (closed form per segment)
+  int k;
+  _t[0] = 0.0;
+  _p[0] = 0.0;
+  _v[0] = 0.0;
+  _a[0] = 0.0;
+  k = 0;
+  while (k < 7)
+  {
+    float h = dur[k];
+    float j = jerk[k];
+    _j[k] = j;
+    _t[k + 1] = _t[k] + h;
+    _a[k + 1] = _a[k] + j * h;
+    _v[k + 1] = _v[k] + _a[k] * h + j * h * h / 2.0;
+    _p[k + 1] = _p[k] + _v[k] * h + _a[k] * h * h / 2.0 + j * h * h * h / 6.0;
+    k++;
+  }
+  // Remove the tiny residual acceleration/velocity left by float rounding
+  _a[7] = 0.0;
+  _v[7] = 0.0;
+  _p[7] = d;
+  return true;
+}
+
+void MotionProfile::sample(float t, float* pos, float* vel, float* acc) const {
+  float p, v, a;
+
+  if (t <= 0.0)
+  {
+    p = _p[0];
+    v = 0.0;
+    a = 0.0;
+  }
+  else if (t >= _t[7])
+  {
+    p = _p[7];
+    v = 0.0;
+    a = 0.0;
+  }
+  else
+  {
+    int k = 0;
+    while (k < 6 && t >= _t[k + 1])
+      k++;
+    float h = t - _t[k];
+    float j = _j[k];
+    a = _a[k] + j * h;
+    v = _v[k] + _a[k] * h + j * h * h / 2.0;
+    p = _p[k] + _v[k] * h + _a[k] * h * h / 2.0 + j * h * h * h / 6.0;
+  }
+
+  if (pos != NULL)
+    *pos = p * _sign;
+  if (vel != NULL)
+    *vel = v * _sign;
+  if (acc != NULL)
+    *acc = a * _sign;
+}
+
+float MotionProfile::getDuration() const {
+  return _t[7];
+}
+
+bool MotionProfile::isFinished(float t) const {
+  return t >= _t[7];
+}
@@ -0,0 +1,127 @@
+/**
+ * @file MotionProfile.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Acceleration / Jerk Limited Motion Profiles.
+ * SlewLimiter: incremental per-tick limiting (trapezoidal or S-curve).
+ * MotionProfile: precomputed jerk-limited point-to-point move.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef MOTION_PROFILE_H
+#define MOTION_PROFILE_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Follows a (possibly jumping) target with bounded rate of change.
+ * Stateless apart from the current value and rate: nothing is stored ahead,
+ * so one update() per tick is a handful of float operations.
+ * - maxJerk == 0: trapezoidal (rate limited to +/- maxRate).
+ * - maxJerk  > 0: S-curve. The rate changes by at most maxJerk * dt per
+ *   tick, including when it lands on the target, and is eased off early
+ *   enough (for the current dt) to land without overshoot. Only a target
+ *   that jumps inside the braking distance is overshot, and then
+ *   approached again within the same limits.
+ *
+ * Usage Example (velocity command, 50 ms task):
+ * SlewLimiter speed(0.5);            // 0.5 m/s^2
+ * float v = speed.update(joyV, 0.05);
+ */
+class SlewLimiter {
+  private:
+    float _maxRate;  // Max rate of change (units/s), e.g. acceleration
+    float _maxJerk;  // Max change of rate (units/s^2), 0 = trapezoidal
+    float _value;    // Current output
+    float _rate;     // Current rate of change (S-curve only)
+
+  public:
+    /**
+     * @param maxRate Max rate of change per second (0 = unlimited).
+     * @param maxJerk Max change of the rate per second (0 = trapezoidal).
+     */
+    SlewLimiter(float maxRate = 0.0, float maxJerk = 0.0);
+
+    /**
+     * @brief Changes the limits. Takes effect on the next update().
+     */
+    void setLimits(float maxRate, float maxJerk = 0.0);
+
+    /**
+     * @brief Advances one tick towards the target.
+     * @param target Desired value.
+     * @param dt Tick length in seconds.
+     * @return float Limited value.
+     */
+    float update(float target, float dt);
+
+    /**
+     * @brief Jumps to a value with zero rate (e.g. after an emergency stop).
+     */
+    void reset(float value = 0.0);
+
+    float getValue() const;
+    float getRate() const;
+};
+
+/**
+ * @brief Rest-to-rest jerk-limited (7-segment S-curve) point-to-point move.
+ * plan() solves the segment durations once; sample() evaluates position,
+ * velocity and acceleration in closed form at any time. If the distance is
+ * too short to reach maxVel (or maxAcc), the peak is lowered automatically.
+ *
+ * Usage Example:
+ * MotionProfile move;
+ * move.plan(0.50, 0.3, 1.0, 5.0);  // 50 cm, 0.3 m/s, 1 m/s^2, 5 m/s^3
+ * float t = (millis() - startMs) / 1000.0;
+ * move.sample(t, &pos, &vel, &acc);
+ */
+class MotionProfile {
+  private:
+    float _t[8];     // Segment start times (_t[7] = total duration)
+    float _p[8];     // Position at segment start
+    float _v[8];     // Velocity at segment start
+    float _a[8];     // Acceleration at segment start
+    float _j[7];     // Jerk inside each segment
+    float _sign;     // Direction of the move
+
+    static float accelDistance(float vPeak, float maxAcc, float maxJerk);
+
+  public:
+    MotionProfile();
+
+    /**
+     * @brief Precomputes a move.
+     * @param distance Signed travel (any unit, e.g. m or rad).
+     * @param maxVel Velocity limit (> 0).
+     * @param maxAcc Acceleration limit (> 0).
+     * @param maxJerk Jerk limit (> 0).
+     * @return true if the parameters were valid.
+     */
+    bool plan(float distance, float maxVel, float maxAcc, float maxJerk);
+
+    /**
+     * @brief Evaluates the move at time t (seconds since start).
+     * Before 0 the start state is returned, after the end the final one.
+     * Any output pointer may be NULL.
+     */
+    void sample(float t, float* pos, float* vel = NULL, float* acc = NULL) const;
+
+    /**
+     * @brief Total duration of the planned move in seconds.
+     */
+    float getDuration() const;
+
+    /**
+     * @brief True once t is past the end of the move.
+     */
+    bool isFinished(float t) const;
+};
+
+#endif
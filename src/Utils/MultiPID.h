@@ -0,0 +1,241 @@
+/**
+ * @file MultiPID.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Batched Multi-Axis PID Controller (Struct-of-Arrays).
+ * Computes N axes in one call from a single timestamp.
+ * @version 1.1.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef MULTI_PID_H
+#define MULTI_PID_H
+
+#include <Arduino.h>
+#include "FastPID.h"
+
+/**
+ * @brief N independent PID loops sharing one clock read and one sample gate.
+ * Gains and state live in contiguous arrays (one per term), so the per-axis
+ * loops are branch-free and can be auto-vectorized on capable targets:
+ * everything that depends only on the timestamp (dt ratios, derivative
+ * filter factor) is computed once per call, outside the loop.
+ * Each axis gives exactly the same result as its own BasicFastPID<T> with
+ * the same gains, limits, sample time and derivative filter.
+ *
+ * Usage Example (6-joint arm):
+ * MultiPID<6> arm(10);               // 10 ms sample time for all joints
+ * arm.setTunings(0, 4.0, 0.2, 1.0);  // Per-joint gains
+ * arm.setOutputLimits(0, -1023, 1023);
+ * if (arm.compute(targets, positions))
+ *   for (int i = 0; i < 6; i++) Dxl.writeSpeed(i + 1, arm.getOutput(i));
+ *
+ * @tparam N Number of axes.
+ * @tparam T Numeric type (float, or FixedPoint<F>).
+ */
+template <int N, class T = float>
+class MultiPID {
+  private:
+    T _kp[N];
+    T _ki[N];
+    T _kd[N];
+    T _outputMin[N];
+    T _outputMax[N];
+
+    T _integral[N];
+    T _lastInput[N];
+    T _dFiltered[N];
+    T _output[N];
+
+    unsigned long _lastTime;
+    unsigned long _sampleTime; // Shared calculation interval (ms or us)
+    unsigned long _dFilterTau; // Shared derivative filter constant (0 = off)
+    int _timeBase;             // PID_TIMEBASE_MILLIS or PID_TIMEBASE_MICROS
+    bool _firstRun;
+
+  public:
+    /**
+     * @brief Construct a new Multi PID object. All gains start at zero.
+     * @param sampleTime How often to calculate in ms (default: 20ms).
+     */
+    MultiPID(int sampleTime = 20) {
+      int i;
+
+      _sampleTime = sampleTime;
+      _timeBase = PID_TIMEBASE_MILLIS;
+      _dFilterTau = 0;
+      _lastTime = 0;
+      _firstRun = true;
+
+      i = 0;
+      while (i < N)
+      {
+        _kp[i] = T(0);
+        _ki[i] = T(0);
+        _kd[i] = T(0);
+        _outputMin[i] = T(-255);
+        _outputMax[i] = T(255);
+        i++;
+      }
+      reset();
+    }
+
+    /**
+     * @brief Sets the gains of one axis (negative gains are rejected).
+     */
+    void setTunings(int axis, T kp, T ki, T kd) {
+      if (axis < 0 || axis >= N)
+        return;
+      if (kp < T(0) || ki < T(0) || kd < T(0))
+        return;
+      _kp[axis] = kp;
+      _ki[axis] = ki;
+      _kd[axis] = kd;
+    }
+
+    /**
+     * @brief Sets the output limits of one axis.
+     */
+    void setOutputLimits(int axis, T min, T max) {
+      if (axis < 0 || axis >= N || min >= max)
+        return;
+      _outputMin[axis] = min;
+      _outputMax[axis] = max;
+
+      if (_integral[axis] > max)
+        _integral[axis] = max;
+      else if (_integral[axis] < min)
+        _integral[axis] = min;
+    }
+
+    /**
+     * @brief Changes the shared interval and time base. See BasicFastPID.
+     */
+    void setSampleTime(unsigned long sampleTime, int timeBase = PID_TIMEBASE_MILLIS) {
+      if (timeBase != _timeBase)
+        _firstRun = true;
+      _sampleTime = sampleTime;
+      _timeBase = timeBase;
+    }
+
+    /**
+     * @brief Shared derivative low-pass time constant (ticks). 0 disables it.
+     */
+    void setDerivativeFilter(unsigned long tau) {
+      _dFilterTau = tau;
+    }
+
+    /**
+     * @brief Computes all axes if the sample time has passed.
+     * @param setpoints Array of N targets.
+     * @param inputs Array of N measurements.
+     * @return true if new outputs were calculated.
+     */
+    bool compute(const T* setpoints, const T* inputs) {
+      unsigned long now = (_timeBase == PID_TIMEBASE_MICROS) ? micros() : millis();
+      return compute(setpoints, inputs, now);
+    }
+
+    /**
+     * @brief Computes all axes from an externally supplied timestamp.
+     * @param now Current time in the controller's time base (ms or us).
+     */
+    bool compute(const T* setpoints, const T* inputs, unsigned long now) {
+      unsigned long timeChange = (now - _lastTime);
+      int i;
+
+      if (_firstRun)
+        timeChange = _sampleTime;
+      else if (timeChange == 0 && _sampleTime > 0)
+        return false;
+
+      if (timeChange < _sampleTime)
+        return false;
+
+      // Shared per-sample factors: computed once, not N times
+      T dtRatio = T(1);
+      T rateScale = T(1);
+      if (_sampleTime > 0 && timeChange != _sampleTime)
+      {
+        dtRatio = pidDtRatio<T>(timeChange, _sampleTime);
+        rateScale = PIDRatio<T>::get(_sampleTime, timeChange);
+      }
+      T keep = T(0); // Derivative filter: tau / (tau + dt), 0 = off
+      if (_dFilterTau > 0)
+        keep = PIDRatio<T>::get(_dFilterTau, _dFilterTau + timeChange);
+
+      // Same operation order as BasicFastPID::compute() for identical results
+      i = 0;
+      while (i < N)
+      {
+        T error = setpoints[i] - inputs[i];
+
+        T integral = _integral[i] + (_ki[i] * error * dtRatio);
+        integral = (integral > _outputMax[i]) ? _outputMax[i] :
+                   (integral < _outputMin[i]) ? _outputMin[i] : integral;
+        _integral[i] = integral;
+
+        T dInput = (inputs[i] - _lastInput[i]) * rateScale;
+        T dFiltered = dInput + keep * (_dFiltered[i] - dInput);
+        _dFiltered[i] = dFiltered;
+
+        T output = (_kp[i] * error) + integral - (_kd[i] * dFiltered);
+        output = (output > _outputMax[i]) ? _outputMax[i] :
+                 (output < _outputMin[i]) ? _outputMin[i] : output;
+
+        _output[i] = output;
+        _lastInput[i] = inputs[i];
+        i++;
+      }
+
+      _lastTime = now;
+      _firstRun = false;
+      return true;
+    }
+
+    /**
+     * @brief Latest output of one axis.
+     */
+    T getOutput(int axis) const {
+      if (axis < 0 || axis >= N)
+        return T(0);
+      return _output[axis];
+    }
+
+    /**
+     * @brief Latest outputs of all axes (array of N).
+     */
+    const T* getOutputs() const {
+      return _output;
+    }
+
+    /**
+     * @brief Resets integral and history of every axis.
+     */
+    void reset() {
+      int i;
+
+      i = 0;
+      while (i < N)
+        reset(i++);
+    }
+
+    /**
+     * @brief Resets integral and history of one axis.
+     */
+    void reset(int axis) {
+      if (axis < 0 || axis >= N)
+        return;
+      _integral[axis] = T(0);
+      _lastInput[axis] = T(0);
+      _dFiltered[axis] = T(0);
+      _output[axis] = T(0);
+    }
+};
+
+#endif
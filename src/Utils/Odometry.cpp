@@ -0,0 +1,136 @@
+/**
+ * @file Odometry.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of Odometry.
+ * @version 1.0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "Odometry.h"
+
+#define ODOM_SUBMICRON 65536.0 // Position units per um (Q16)
+
+// Critical section that restores the previous interrupt state, so it is
+// safe inside an ISR (a plain interrupts() would re-enable nesting there)
+#if defined(__AVR__)
+  #define ODOM_LOCK()   uint8_t odomState = SREG; cli()
+  #define ODOM_UNLOCK() SREG = odomState
+#elif defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+  #define ODOM_LOCK()   uint32_t odomState; \
+                        __asm__ volatile ("mrs %0, primask\n cpsid i" : "=r" (odomState) :: "memory")
+  #define ODOM_UNLOCK() __asm__ volatile ("msr primask, %0" :: "r" (odomState) : "memory")
+#else
+  #define ODOM_LOCK()   noInterrupts()
+  #define ODOM_UNLOCK() interrupts()
+#endif
+
+Odometry::Odometry() {
+  _x = 0;
+  _y = 0;
+  _theta = 0;
+  _distPerTick = 0;
+  _anglePerTick = 0;
+  _lastLeft = 0;
+  _lastRight = 0;
+  _primed = false;
+}
+
+/**
+ * @brief Float math happens here only, once.
+ */
+void Odometry::setGeometry(float wheelRadius, float trackWidth, float countsPerRev) {
+  if (countsPerRev <= 0.0 || trackWidth <= 0.0)
+    return;
+
+  float metersPerTick = 6.2831853 * wheelRadius / countsPerRev;
+  // rad per (dR - dL) tick -> binary angle (2^32 per turn)
+  float radPerTick = metersPerTick / trackWidth;
+
+  _distPerTick = (int32_t)(metersPerTick * 1000000.0 * ODOM_SUBMICRON + 0.5);
+  _anglePerTick = (int32_t)(radPerTick * (4294967296.0 / 6.2831853) + 0.5);
+}
+
+void Odometry::update(long leftCount, long rightCount) {
+  if (!_primed)
+  {
+    _lastLeft = leftCount;
+    _lastRight = rightCount;
+    _primed = true;
+    return;
+  }
+  long dLeft = leftCount - _lastLeft;
+  long dRight = rightCount - _lastRight;
+  _lastLeft = leftCount;
+  _lastRight = rightCount;
+  updateDelta(dLeft, dRight);
+}
+
+void Odometry::updateDelta(long dLeft, long dRight) {
+  if (dLeft == 0 && dRight == 0)
+    return;
+
+  // 1. Heading change (binary angle, wraps naturally)
+  uint32_t dTheta = (uint32_t)((int64_t)(dRight - dLeft) * _anglePerTick);
+  uint32_t mid = _theta + (uint32_t)((int32_t)dTheta / 2);
+
+  // 2. Travel: (dL + dR) ticks in Q16 um (the / 2 is folded into the shift)
+  int64_t ds = (int64_t)(dLeft + dRight) * _distPerTick;
+
+  // 3. Midpoint step: ds * Q15 trig, >> 15 for Q15 and >> 1 for the average
+  int64_t dx = (ds * fixedCos(mid)) >> 16;
+  int64_t dy = (ds * fixedSin(mid)) >> 16;
+
+  // 4. Commit with interrupts off so getPose() never sees half a pose
+  ODOM_LOCK();
+  _x += dx;
+  _y += dy;
+  _theta += dTheta;
+  ODOM_UNLOCK();
+}
+
+void Odometry::setPose(float x, float y, float theta) {
+  int64_t nx = (int64_t)(x * 1000000.0 * ODOM_SUBMICRON);
+  int64_t ny = (int64_t)(y * 1000000.0 * ODOM_SUBMICRON);
+  uint32_t nt = radiansToAngle(theta);
+
+  ODOM_LOCK();
+  _x = nx;
+  _y = ny;
+  _theta = nt;
+  ODOM_UNLOCK();
+}
+
+Pose Odometry::getPose() {
+  ODOM_LOCK();
+  int64_t x = _x;
+  int64_t y = _y;
+  uint32_t t = _theta;
+  ODOM_UNLOCK();
+
+  Pose p;
+  p.x = (float)x / (1000000.0 * ODOM_SUBMICRON);
+  p.y = (float)y / (1000000.0 * ODOM_SUBMICRON);
+  p.theta = angleToRadians(t);
+  return p;
+}
+
+void Odometry::getRawPose(long* xUm, long* yUm, uint32_t* theta) {
+  ODOM_LOCK();
+  int64_t x = _x;
+  int64_t y = _y;
+  uint32_t t = _theta;
+  ODOM_UNLOCK();
+
+  if (xUm != NULL)
+    *xUm = (long)(x / (int64_t)ODOM_SUBMICRON);
+  if (yUm != NULL)
+    *yUm = (long)(y / (int64_t)ODOM_SUBMICRON);
+  if (theta != NULL)
+    *theta = t;
+}
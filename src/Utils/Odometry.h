@@ -0,0 +1,111 @@
+/**
+ * @file Odometry.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Differential-Drive Pose Estimation from Wheel Ticks.
+ * Integer-only update: fixed-point position, binary-angle heading,
+ * table sin/cos and a second-order (midpoint heading) step.
+ * @version 1.0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef ODOMETRY_H
+#define ODOMETRY_H
+
+#include <Arduino.h>
+#include "FixedTrig.h"
+
+/**
+ * @brief Pose snapshot in SI units.
+ */
+struct Pose {
+  float x;      // m
+  float y;      // m
+  float theta;  // rad, -PI..PI
+};
+
+/**
+ * @brief Integrates encoder deltas into (x, y, theta).
+ *
+ * Per update, with dL/dR the wheel tick deltas:
+ * ds     = (dL + dR) / 2 * distancePerTick
+ * dTheta = (dR - dL) * distancePerTick / trackWidth
+ * x     += ds * cos(theta + dTheta / 2)   (Runge-Kutta 2 / midpoint)
+ * y     += ds * sin(theta + dTheta / 2)
+ *
+ * Both per-tick factors are converted to integers once in setGeometry(),
+ * so update() is a few multiplies, two table lookups and adds. Position
+ * is kept in Q16 micrometers (int64) so sub-micron steps are never truncated
+ * away at high update rates; heading is a 32-bit binary angle that wraps
+ * exactly at one turn.
+ *
+ * update() may run in an ISR or a fast task; getPose() copies the state
+ * with interrupts off, so readers never see a half-written pose. On AVR
+ * and Cortex-M the critical sections restore the previous interrupt state
+ * (SREG / PRIMASK), so they do not re-enable interrupts inside an ISR.
+ * Other cores use noInterrupts() / interrupts(): call update() from a
+ * task there, not from an ISR.
+ *
+ * Usage Example:
+ * Odometry odom;
+ * odom.setGeometry(0.033, 0.16, 1200); // wheel radius, track, counts/rev
+ * odom.update(encL.getCount(), encR.getCount());
+ * Pose p = odom.getPose();
+ */
+class Odometry {
+  private:
+    int64_t _x;            // Position, Q16 um
+    int64_t _y;
+    uint32_t _theta;       // Binary angle heading
+
+    int32_t _distPerTick;  // Q16 um per tick (up to 32 mm per tick)
+    int32_t _anglePerTick; // Binary angle per (dR - dL) tick
+
+    long _lastLeft;        // Absolute counts seen by update(left, right)
+    long _lastRight;
+    bool _primed;          // First absolute reading taken
+
+  public:
+    Odometry();
+
+    /**
+     * @brief Sets the geometry and precomputes the integer factors.
+     * @param wheelRadius Wheel radius in meters.
+     * @param trackWidth Distance between the wheels in meters.
+     * @param countsPerRev Encoder ticks per wheel revolution.
+     */
+    void setGeometry(float wheelRadius, float trackWidth, float countsPerRev);
+
+    /**
+     * @brief Integrates absolute encoder counts (e.g. QuadEncoder::getCount()).
+     * The first call only latches the counts.
+     */
+    void update(long leftCount, long rightCount);
+
+    /**
+     * @brief Integrates tick deltas since the previous call.
+     */
+    void updateDelta(long dLeft, long dRight);
+
+    /**
+     * @brief Sets the pose (e.g. to a known start position).
+     */
+    void setPose(float x, float y, float theta);
+
+    /**
+     * @brief Atomic pose snapshot in meters / radians.
+     */
+    Pose getPose();
+
+    /**
+     * @brief Atomic raw snapshot: position in um, heading as binary angle.
+     */
+    void getRawPose(long* xUm, long* yUm, uint32_t* theta);
+};
+
+#endif
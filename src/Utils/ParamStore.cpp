@@ -0,0 +1,323 @@
+/**
+ * @file ParamStore.cpp
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Implementation of ParamStore.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "ParamStore.h"
+
+#define PARAM_MAGIC 0x5350 // "PS"
+#define PARAM_FREE  0xFF   // Erased key byte = end of log
+
+ParamStore::ParamStore(int address, int size) {
+  _address = address;
+  _bankSize = size / 2;
+  if (_bankSize > 65535)
+    _bankSize = 65535;
+  _bank = 0;
+  _generation = 0;
+  _end = PARAM_BANK_HEADER;
+  memset(_offset, 0, sizeof(_offset));
+}
+
+/**
+ * @brief CRC-8 (poly 0x07), one byte at a time.
+ */
+uint8_t ParamStore::crc8(uint8_t crc, uint8_t data) {
+  uint8_t bit;
+
+  crc ^= data;
+  bit = 0;
+  while (bit < 8)
+  {
+    crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    bit++;
+  }
+  return crc;
+}
+
+int ParamStore::bankAddress(uint8_t bank) {
+  return _address + (int)bank * _bankSize;
+}
+
+bool ParamStore::readBankHeader(uint8_t bank, uint16_t* generation) {
+  int base = bankAddress(bank);
+  uint16_t magic = EEPROM.read(base) | ((uint16_t)EEPROM.read(base + 1) << 8);
+  if (magic != PARAM_MAGIC)
+    return false;
+  *generation = EEPROM.read(base + 2) | ((uint16_t)EEPROM.read(base + 3) << 8);
+  return true;
+}
+
+/**
+ * @brief Generation first, magic last: the bank only becomes valid at the end.
+ */
+void ParamStore::writeBankHeader(uint8_t bank, uint16_t generation) {
+  int base = bankAddress(bank);
+  EEPROM.update(base + 2, (uint8_t)(generation & 0xFF));
+  EEPROM.update(base + 3, (uint8_t)(generation >> 8));
+  EEPROM.update(base + 1, (uint8_t)(PARAM_MAGIC >> 8));
+  EEPROM.update(base, (uint8_t)(PARAM_MAGIC & 0xFF));
+}
+
+bool ParamStore::begin() {
+  uint16_t gen0 = 0, gen1 = 0;
+  bool ok0 = readBankHeader(0, &gen0);
+  bool ok1 = readBankHeader(1, &gen1);
+
+  if (!ok0 && !ok1)
+  {
+    // Blank or foreign data: format bank 0 (an empty log is one end marker)
+    EEPROM.update(bankAddress(0) + PARAM_BANK_HEADER, PARAM_FREE);
+    writeBankHeader(0, 1);
+    _bank = 0;
+    _generation = 1;
+    scan();
+    return false;
+  }
+
+  // Newest generation wins (wrap-safe)
+  if (ok0 && (!ok1 || (int16_t)(gen0 - gen1) > 0))
+  {
+    _bank = 0;
+    _generation = gen0;
+  }
+  else
+  {
+    _bank = 1;
+    _generation = gen1;
+  }
+  scan();
+  return true;
+}
+
+/**
+ * @brief Rebuilds the RAM index with one pass over the active bank.
+ */
+void ParamStore::scan() {
+  int base = bankAddress(_bank);
+  uint16_t pos = PARAM_BANK_HEADER;
+
+  memset(_offset, 0, sizeof(_offset));
+  while (pos + PARAM_RECORD_OVERHEAD <= _bankSize)
+  {
+    uint8_t key = EEPROM.read(base + pos);
+    if (key == PARAM_FREE)
+      break;
+    uint8_t meta = EEPROM.read(base + pos + 1);
+    uint8_t length = meta & 0x3F;
+    if (pos + PARAM_RECORD_OVERHEAD + length > _bankSize)
+      break;
+
+    uint8_t crc = crc8(crc8(0, key), meta);
+    uint8_t i = 0;
+    while (i < length)
+    {
+      crc = crc8(crc, EEPROM.read(base + pos + 2 + i));
+      i++;
+    }
+    // A bad CRC is bit rot in a complete record: skip it, keep scanning
+    if (crc == EEPROM.read(base + pos + 2 + length) && key < PARAM_MAX_KEYS)
+      _offset[key] = ((meta >> 6) == PARAM_TYPE_ERASED) ? 0 : pos;
+    pos += PARAM_RECORD_OVERHEAD + length;
+  }
+  _end = pos;
+}
+
+/**
+ * @brief Writes one record at _end: body, then the end marker after it,
+ * then the key byte (commit point). Bytes past the marker are never
+ * read, so the bank needs no erase; a torn append leaves the old marker
+ * at _end and is overwritten by the next one.
+ */
+bool ParamStore::append(uint8_t key, uint8_t type, const uint8_t* data, uint8_t length) {
+  uint16_t need = PARAM_RECORD_OVERHEAD + length;
+  if (_end + need > _bankSize)
+  {
+    if (!compactInto(_bank ^ 1) || _end + need > _bankSize)
+      return false;
+  }
+
+  int base = bankAddress(_bank) + _end;
+  uint8_t meta = (uint8_t)((type << 6) | length);
+  uint8_t crc = crc8(crc8(0, key), meta);
+  uint8_t i;
+
+  EEPROM.update(base + 1, meta);
+  i = 0;
+  while (i < length)
+  {
+    EEPROM.update(base + 2 + i, data[i]);
+    crc = crc8(crc, data[i]);
+    i++;
+  }
+  EEPROM.update(base + 2 + length, crc);
+  if (_end + need < _bankSize)
+    EEPROM.update(base + need, PARAM_FREE);
+  EEPROM.update(base, key); // Commit point
+
+  _offset[key] = (type == PARAM_TYPE_ERASED) ? 0 : _end;
+  _end += need;
+  return true;
+}
+
+/**
+ * @brief Copies the newest record of every key into an erased bank, then
+ * switches to it. The key being set is copied too, so its old value
+ * survives a power cut between the compaction and the new record.
+ */
+bool ParamStore::compactInto(uint8_t bank) {
+  int from = bankAddress(_bank);
+  int to = bankAddress(bank);
+  uint16_t pos = PARAM_BANK_HEADER;
+  uint16_t newOffset[PARAM_MAX_KEYS];
+  int i;
+  uint8_t key;
+
+  // 1. Live records, copied verbatim. The target's old header has an
+  // older generation, so a power cut anywhere here leaves the current
+  // bank in charge.
+  memset(newOffset, 0, sizeof(newOffset));
+  key = 0;
+  while (key < PARAM_MAX_KEYS)
+  {
+    if (_offset[key] != 0)
+    {
+      uint8_t length = EEPROM.read(from + _offset[key] + 1) & 0x3F;
+      uint16_t size = PARAM_RECORD_OVERHEAD + length;
+      if (pos + size > _bankSize)
+        return false;
+      i = size - 1;
+      while (i >= 0)
+      {
+        EEPROM.update(to + pos + i, EEPROM.read(from + _offset[key] + i));
+        i--;
+      }
+      newOffset[key] = pos;
+      pos += size;
+    }
+    key++;
+  }
+
+  // 2. End marker, then commit: newer generation makes the target active
+  if (pos < _bankSize)
+    EEPROM.update(to + pos, PARAM_FREE);
+  writeBankHeader(bank, (uint16_t)(_generation + 1));
+  _bank = bank;
+  _generation++;
+  _end = pos;
+  memcpy(_offset, newOffset, sizeof(_offset));
+  return true;
+}
+
+bool ParamStore::compact() {
+  return compactInto(_bank ^ 1);
+}
+
+/**
+ * @brief True if the stored record already holds exactly this value.
+ */
+bool ParamStore::equals(uint8_t key, uint8_t type, const uint8_t* data, uint8_t length) {
+  if (_offset[key] == 0)
+    return false;
+  int base = bankAddress(_bank) + _offset[key];
+  if (EEPROM.read(base + 1) != (uint8_t)((type << 6) | length))
+    return false;
+
+  uint8_t i = 0;
+  while (i < length)
+  {
+    if (EEPROM.read(base + 2 + i) != data[i])
+      return false;
+    i++;
+  }
+  return true;
+}
+
+bool ParamStore::setBlob(uint8_t key, const void* data, uint8_t length) {
+  if (key >= PARAM_MAX_KEYS || length > PARAM_MAX_BLOB)
+    return false;
+  if (equals(key, PARAM_TYPE_BLOB, (const uint8_t*)data, length))
+    return true; // Unchanged: no write at all
+  return append(key, PARAM_TYPE_BLOB, (const uint8_t*)data, length);
+}
+
+bool ParamStore::setInt(uint8_t key, long value) {
+  int32_t v = (int32_t)value;
+  if (key >= PARAM_MAX_KEYS)
+    return false;
+  if (equals(key, PARAM_TYPE_INT, (const uint8_t*)&v, sizeof(v)))
+    return true;
+  return append(key, PARAM_TYPE_INT, (const uint8_t*)&v, sizeof(v));
+}
+
+bool ParamStore::setFloat(uint8_t key, float value) {
+  if (key >= PARAM_MAX_KEYS)
+    return false;
+  if (equals(key, PARAM_TYPE_FLOAT, (const uint8_t*)&value, sizeof(value)))
+    return true;
+  return append(key, PARAM_TYPE_FLOAT, (const uint8_t*)&value, sizeof(value));
+}
+
+bool ParamStore::erase(uint8_t key) {
+  if (key >= PARAM_MAX_KEYS)
+    return false;
+  if (_offset[key] == 0)
+    return true;
+  return append(key, PARAM_TYPE_ERASED, NULL, 0);
+}
+
+/**
+ * @brief Copies a value of the given type. Returns its length or -1.
+ */
+int ParamStore::read(uint8_t key, uint8_t type, uint8_t* data, int maxLength) {
+  if (key >= PARAM_MAX_KEYS || _offset[key] == 0)
+    return -1;
+  int base = bankAddress(_bank) + _offset[key];
+  uint8_t meta = EEPROM.read(base + 1);
+  if ((meta >> 6) != type)
+    return -1;
+
+  int length = meta & 0x3F;
+  int i = 0;
+  while (i < length && i < maxLength)
+  {
+    data[i] = EEPROM.read(base + 2 + i);
+    i++;
+  }
+  return length;
+}
+
+long ParamStore::getInt(uint8_t key, long fallback) {
+  int32_t v;
+  if (read(key, PARAM_TYPE_INT, (uint8_t*)&v, sizeof(v)) != (int)sizeof(v))
+    return fallback;
+  return (long)v;
+}
+
+float ParamStore::getFloat(uint8_t key, float fallback) {
+  float v;
+  if (read(key, PARAM_TYPE_FLOAT, (uint8_t*)&v, sizeof(v)) != (int)sizeof(v))
+    return fallback;
+  return v;
+}
+
+int ParamStore::getBlob(uint8_t key, void* buffer, int maxLength) {
+  return read(key, PARAM_TYPE_BLOB, (uint8_t*)buffer, maxLength);
+}
+
+bool ParamStore::has(uint8_t key) {
+  return key < PARAM_MAX_KEYS && _offset[key] != 0;
+}
+
+int ParamStore::freeBytes() {
+  return _bankSize - _end;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file ParamStore.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Log-Structured Key-Value Parameter Store in EEPROM.
+ * Values are appended as small records; a RAM index gives O(1) lookup.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef PARAM_STORE_H
+#define PARAM_STORE_H
+
+#include <Arduino.h>
+#include <EEPROM.h>
+
+#define PARAM_MAX_KEYS 32      // Keys are 0 .. PARAM_MAX_KEYS-1
+#define PARAM_MAX_BLOB 63      // Max value length in bytes
+#define PARAM_BANK_HEADER 4    // magic(2) generation(2)
+#define PARAM_RECORD_OVERHEAD 3 // key(1) meta(1) crc(1)
+
+#define PARAM_TYPE_BLOB  0
+#define PARAM_TYPE_INT   1
+#define PARAM_TYPE_FLOAT 2
+#define PARAM_TYPE_ERASED 3
+
+/**
+ * @brief Small key-value store for tunables (gains, offsets, names).
+ * No addresses to hand-assign: each parameter is a numeric key.
+ *
+ * The region is split into two banks. Records are appended to the
+ * active bank: [key | type:2 len:6 | data... | crc8], ended by a 0xFF key
+ * byte. The key byte is written last, so an interrupted write leaves the
+ * 0xFF end marker in place and is simply free space on the next boot.
+ * Setting a parameter writes only its own record plus the end marker
+ * (and nothing at all if the value did not change).
+ *
+ * When the active bank is full, the newest record of every key is copied
+ * to the other bank, whose header (higher generation) is written last;
+ * until then the old bank stays the valid one.
+ *
+ * Usage Example:
+ * #define P_KP 0
+ * #define P_NAME 1
+ * ParamStore params(64, 512);   // EEPROM bytes 64..575
+ * params.begin();
+ * params.setFloat(P_KP, 2.5);
+ * float kp = params.getFloat(P_KP, 1.0); // 1.0 if never set
+ */
+class ParamStore {
+  private:
+    int _address;     // EEPROM start of bank 0
+    int _bankSize;    // Bytes per bank
+    uint8_t _bank;    // Active bank (0 or 1)
+    uint16_t _generation; // Generation of the active bank
+    uint16_t _end;    // First free byte in the active bank
+    uint16_t _offset[PARAM_MAX_KEYS]; // Newest record per key (0 = absent)
+
+    int bankAddress(uint8_t bank);
+    bool readBankHeader(uint8_t bank, uint16_t* generation);
+    void writeBankHeader(uint8_t bank, uint16_t generation);
+    void scan();
+    bool append(uint8_t key, uint8_t type, const uint8_t* data, uint8_t length);
+    bool equals(uint8_t key, uint8_t type, const uint8_t* data, uint8_t length);
+    bool compactInto(uint8_t bank);
+    int read(uint8_t key, uint8_t type, uint8_t* data, int maxLength);
+
+    static uint8_t crc8(uint8_t crc, uint8_t data);
+
+  public:
+    /**
+     * @brief Construct a new Param Store object.
+     * @param address EEPROM start address.
+     * @param size Total bytes used (two banks of size / 2, max 2 x 65535).
+     */
+    ParamStore(int address, int size);
+
+    /**
+     * @brief Finds the active bank and rebuilds the RAM index.
+     * Formats the region if no valid bank exists.
+     * @return true if existing parameters were found.
+     */
+    bool begin();
+
+    /**
+     * @brief Stores a value. Blocking: writes one record (~3.3 ms per byte
+     * on AVR), or the whole live set when a compaction is needed.
+     * @return true on success, false if the key is invalid or the live set
+     * does not fit in one bank.
+     */
+    bool setInt(uint8_t key, long value);
+    bool setFloat(uint8_t key, float value);
+    bool setBlob(uint8_t key, const void* data, uint8_t length);
+
+    /**
+     * @brief Reads a value; returns fallback if the key is unset or has another type.
+     */
+    long getInt(uint8_t key, long fallback = 0);
+    float getFloat(uint8_t key, float fallback = 0.0);
+
+    /**
+     * @brief Copies a blob value.
+     * @return int Value length, or -1 if unset. Copies at most maxLength bytes.
+     */
+    int getBlob(uint8_t key, void* buffer, int maxLength);
+
+    /**
+     * @brief True if the key currently has a value.
+     */
+    bool has(uint8_t key);
+
+    /**
+     * @brief Removes a key (appends a tombstone record).
+     */
+    bool erase(uint8_t key);
+
+    /**
+     * @brief Bytes left in the active bank before the next compaction.
+     */
+    int freeBytes();
+
+    /**
+     * @brief Rewrites the live records into the other bank now.
+     */
+    bool compact();
+};
+
+#endif
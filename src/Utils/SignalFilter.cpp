@@ -19,20 +19,38 @@ SignalFilter::~SignalFilter() {
 }
 
 void SignalFilter::begin() {
-  // Allocate memory for the filter buffer
-  _readings = new int[_size];
+  // Allocate memory for the filter buffer (once; begin() again just clears it)
+  if (_readings == NULL)
+    _readings = new int[_size];
   int i;
 
   // Initialize buffer with 0
+  _index = 0;
+  _total = 0;
+  _average = 0;
   i = 0;
   while (i < _size)
     _readings[i++] = 0;
 }
 
+void SignalFilter::fill(int value) {
+  if (_readings == NULL)
+    return;
+  int i;
+
+  i = 0;
+  while (i < _size)
+    _readings[i++] = value;
+  _total = (long)value * _size;
+  _average = value;
+}
+
 /**
  * @brief Adds a new value and calculates the Moving Average.
  */
 int SignalFilter::filter(int input) {
+  if (_readings == NULL)
+    return input; // begin() not called yet
   _total = _total - _readings[_index];
   _readings[_index] = input;
   _total = _total + _readings[_index];
@@ -29,9 +29,16 @@ class SignalFilter
     
     /**
      * @brief Allocates memory and initializes filter buffer.
+     * Calling it again clears the history.
      */
     void begin();
 
+    /**
+     * @brief Sets the whole window to one value (e.g. a first reading),
+     * so the average starts there instead of ramping up from 0.
+     */
+    void fill(int value);
+
     /**
      * @brief Adds a new value and returns the filtered average.
      * @param input Raw sensor value.
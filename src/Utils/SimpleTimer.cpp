@@ -13,13 +13,21 @@ void SimpleTimer::setInterval(unsigned long interval) {
  * @brief Checks if the time interval has elapsed. Automatically resets.
  */
 bool SimpleTimer::isReady() {
-  if (millis() - _previousMillis >= _interval) {
-    _previousMillis = millis();
+  return isReady(millis());
+}
+
+bool SimpleTimer::isReady(unsigned long now) {
+  if (now - _previousMillis >= _interval) {
+    _previousMillis = now;
     return true;
   }
   return false;
 }
 
 void SimpleTimer::reset() {
-  _previousMillis = millis();
+  reset(millis());
+}
+
+void SimpleTimer::reset(unsigned long now) {
+  _previousMillis = now;
 }
\ No newline at end of file
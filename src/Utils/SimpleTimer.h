@@ -31,9 +31,20 @@ class SimpleTimer
      */
     bool isReady();
 
+    /**
+     * @brief Same as isReady(), with the tick's time (e.g. TickClock::ms()).
+     * @param now Current time in milliseconds.
+     */
+    bool isReady(unsigned long now);
+
     /**
      * @brief Manually resets the timer counter.
      */
     void reset();
+
+    /**
+     * @param now Current time in milliseconds.
+     */
+    void reset(unsigned long now);
 };
 #endif
\ No newline at end of file
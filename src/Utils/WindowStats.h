@@ -0,0 +1,271 @@
+/**
+ * @file WindowStats.h
+ * @author iamfurkann (esadfurkanduman@gmail.com)
+ * @brief Sliding-Window Statistics (Min, Max, Mean, Variance, Slope).
+ * Every statistic is amortized O(1) per sample. Fixed capacity, no heap.
+ * @version 1.1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025 Furkan
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef WINDOW_STATS_H
+#define WINDOW_STATS_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Default accumulator per sample type, wide enough for a window
+ * spanning the whole range of T: 8-bit samples fit a long, 16-bit ones
+ * (int on AVR) need 64 bits for the sum of squares, floats stay float.
+ */
+template <class T> struct WindowStatsSum { typedef long long type; };
+template <> struct WindowStatsSum<signed char> { typedef long type; };
+template <> struct WindowStatsSum<unsigned char> { typedef long type; };
+template <> struct WindowStatsSum<char> { typedef long type; };
+template <> struct WindowStatsSum<float> { typedef float type; };
+template <> struct WindowStatsSum<double> { typedef double type; };
+
+// No <type_traits> on AVR
+template <class T> struct WindowStatsIsFloat { static const bool value = false; };
+template <> struct WindowStatsIsFloat<float> { static const bool value = true; };
+template <> struct WindowStatsIsFloat<double> { static const bool value = true; };
+
+/**
+ * @brief Keeps the last N samples and answers window queries in constant time.
+ * - Min / Max: monotonic deques (each sample is pushed and popped at most once).
+ * - Mean / Variance: running sum and sum of squares.
+ * - Slope: running least-squares sums over the sample position.
+ *
+ * Sums are kept relative to a reference sample (shifted data), so integer
+ * accumulators do not overflow and float ones do not lose the variance to
+ * cancellation. They are also rebuilt from the buffer once per window wrap,
+ * which stops float drift while staying amortized O(1).
+ *
+ * Integer sums are exact while N * span^2 fits S, where span is the
+ * largest difference between samples in the window. The default S does
+ * for 8- and 16-bit samples; 32-bit samples must span less than
+ * 2^31 / sqrt(N). When the span is known to be small, a long is enough
+ * and cheaper on AVR: 10-bit ADC readings (span 1023) stay exact in a
+ * long up to N = 2000.
+ *
+ * Usage Example:
+ * WindowStats<int, 32, long> sag;    // Last 32 battery readings (ADC span)
+ * sag.push(analogRead(A0));
+ * int worst = sag.min();
+ *
+ * WindowStats<float, 8> range;       // Last 8 sonar distances
+ * range.push(sonar.getDistance());
+ * float approach = range.slope();     // cm per sample (negative = closing in)
+ *
+ * @tparam T Sample type (int, long, float).
+ * @tparam N Window size (number of samples, >= 2).
+ * @tparam S Accumulator type. Defaults to WindowStatsSum<T> (exact over
+ * the full range of 8- and 16-bit T, float for float T).
+ */
+template <class T, int N, class S = typename WindowStatsSum<T>::type>
+class WindowStats {
+    static_assert(N >= 2, "WindowStats needs a window of at least 2 samples");
+    static_assert(!WindowStatsIsFloat<T>::value || WindowStatsIsFloat<S>::value,
+                  "Float samples need a float accumulator (integer S truncates them)");
+
+  private:
+    T _buf[N];      // Circular sample buffer
+    int _head;      // Next write position (= oldest sample when full)
+    int _count;     // Valid samples (0..N)
+    T _offset;      // Reference sample; sums are kept relative to it
+
+    // Monotonic deques of buffer indices (circular, capacity N)
+    int _minQ[N];
+    int _maxQ[N];
+    int _minHead, _minLen;
+    int _maxHead, _maxLen;
+
+    S _sum;    // Sum(d),     d = y - offset
+    S _sumSq;  // Sum(d^2)
+    S _sumIy;  // Sum(i * d), i = 0 (oldest) .. count-1 (newest)
+
+    void rebuild() {
+      int i;
+      int idx;
+
+      _sum = 0;
+      _sumSq = 0;
+      _sumIy = 0;
+      i = 0;
+      idx = (_head - _count + N) % N;
+      _offset = _buf[idx]; // Re-center on the oldest sample
+      while (i < _count)
+      {
+        S d = (S)_buf[idx] - (S)_offset;
+        _sum += d;
+        _sumSq += d * d;
+        _sumIy += (S)i * d;
+        idx++;
+        if (idx >= N)
+          idx = 0;
+        i++;
+      }
+    }
+
+  public:
+    WindowStats() {
+      reset();
+    }
+
+    /**
+     * @brief Clears the window.
+     */
+    void reset() {
+      _head = 0;
+      _count = 0;
+      _offset = 0;
+      _minHead = 0;
+      _minLen = 0;
+      _maxHead = 0;
+      _maxLen = 0;
+      _sum = 0;
+      _sumSq = 0;
+      _sumIy = 0;
+    }
+
+    /**
+     * @brief Adds a sample, dropping the oldest one when the window is full.
+     * @param value New sample.
+     */
+    void push(T value) {
+      if (_count == 0)
+        _offset = value; // Shifted sums avoid overflow and cancellation
+      S d = (S)value - (S)_offset;
+
+      // 1. Drop the oldest sample (it lives in the slot we are about to reuse)
+      if (_count == N)
+      {
+        S old = (S)_buf[_head] - (S)_offset;
+        // Remaining samples all move one position closer to the front
+        _sum -= old;
+        _sumSq -= old * old;
+        _sumIy -= _sum;
+        _count--;
+
+        if (_minLen > 0 && _minQ[_minHead] == _head)
+        {
+          _minHead = (_minHead + 1) % N;
+          _minLen--;
+        }
+        if (_maxLen > 0 && _maxQ[_maxHead] == _head)
+        {
+          _maxHead = (_maxHead + 1) % N;
+          _maxLen--;
+        }
+      }
+
+      // 2. Add the new sample
+      _sumIy += (S)_count * d;
+      _sum += d;
+      _sumSq += d * d;
+      _count++;
+      _buf[_head] = value;
+
+      // 3. Pop dominated entries from the deque backs, then append
+      while (_minLen > 0 && _buf[_minQ[(_minHead + _minLen - 1) % N]] >= value)
+        _minLen--;
+      _minQ[(_minHead + _minLen) % N] = _head;
+      _minLen++;
+
+      while (_maxLen > 0 && _buf[_maxQ[(_maxHead + _maxLen - 1) % N]] <= value)
+        _maxLen--;
+      _maxQ[(_maxHead + _maxLen) % N] = _head;
+      _maxLen++;
+
+      _head++;
+      if (_head >= N)
+      {
+        _head = 0;
+        rebuild(); // Once per wrap: cancels accumulated float rounding
+      }
+    }
+
+    /**
+     * @brief Number of samples currently in the window.
+     */
+    int count() const {
+      return _count;
+    }
+
+    /**
+     * @brief True once N samples have been collected.
+     */
+    bool isFull() const {
+      return _count == N;
+    }
+
+    /**
+     * @brief Smallest sample in the window (0 if empty).
+     */
+    T min() const {
+      if (_minLen == 0)
+        return 0;
+      return _buf[_minQ[_minHead]];
+    }
+
+    /**
+     * @brief Largest sample in the window (0 if empty).
+     */
+    T max() const {
+      if (_maxLen == 0)
+        return 0;
+      return _buf[_maxQ[_maxHead]];
+    }
+
+    /**
+     * @brief Arithmetic mean of the window.
+     */
+    float mean() const {
+      if (_count == 0)
+        return 0.0;
+      return (float)_offset + (float)_sum / (float)_count;
+    }
+
+    /**
+     * @brief Population variance of the window.
+     */
+    float variance() const {
+      if (_count < 2)
+        return 0.0;
+      float n = (float)_count;
+      float s = (float)_sum;
+      float num = n * (float)_sumSq - s * s;
+      if (num < 0.0)
+        num = 0.0; // Float rounding guard
+      return num / (n * n);
+    }
+
+    /**
+     * @brief Standard deviation of the window.
+     */
+    float stddev() const {
+      return sqrt(variance());
+    }
+
+    /**
+     * @brief Least-squares slope of the window.
+     * @return float Change per sample. Divide by the sample period for a rate.
+     */
+    float slope() const {
+      if (_count < 2)
+        return 0.0;
+      // Sum(i) and Sum(i^2) over i = 0..n-1 are closed-form
+      float n = (float)_count;
+      float sumI = n * (n - 1.0) / 2.0;
+      float sumI2 = (n - 1.0) * n * (2.0 * n - 1.0) / 6.0;
+      float den = n * sumI2 - sumI * sumI;
+      return (n * (float)_sumIy - sumI * (float)_sum) / den;
+    }
+};
+
+#endif